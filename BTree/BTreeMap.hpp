@@ -0,0 +1,295 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BTreeMap.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/14 09:31:05 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/14 09:31:05 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+#ifndef BTREE_MAP_HPP
+#define BTREE_MAP_HPP
+
+# include <memory>
+# include <functional>
+# include "../utils/utils.hpp"
+# include "../utils/pair.hpp"
+# include "b_tree.hpp"
+
+namespace ft {
+	/** @brief BTreeMap
+	 * Same interface as ft::Map, over a B-tree (see b_tree.hpp) instead of a red black tree. Elements sit side by
+	 * side in nodes of a few cache lines rather than in one node each: lookups and in-order walks are faster and
+	 * small elements take less memory, at the cost of iterator stability, any insert or erase invalidating every
+	 * iterator to the map.
+	 *
+	 * @tparam Key
+	 * @tparam T
+	 * @tparam Compare
+	 * @tparam Alloc
+	 */
+	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+	class BTreeMap {
+	public:
+		typedef T			mapped_type;
+		typedef Key			key_type;
+		typedef Alloc		allocator_type;
+		typedef size_t		size_type;
+		typedef ptrdiff_t	difference_type;
+		typedef Compare		key_compare;
+
+		typedef ft::pair<const key_type, mapped_type>	value_type;
+		class value_compare {
+		public:
+			bool operator()(const value_type& x, const value_type& y) const {
+				return key_compare()(x.first, y.first);
+			}
+		};
+		typedef typename	allocator_type::pointer			pointer;
+		typedef typename 	allocator_type::reference 		reference;
+		typedef typename 	allocator_type::const_pointer	const_pointer;
+		typedef typename 	allocator_type::const_reference	const_reference;
+
+		// B-tree
+		typedef ft::b_tree<value_type, key_type, ft::btree_select_first<value_type>, Compare, Alloc>	tree_type;
+		// Iterators
+		typedef typename tree_type::iterator						iterator;
+		typedef typename tree_type::const_iterator					const_iterator;
+		typedef typename tree_type::reverse_iterator				reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator			const_reverse_iterator;
+
+	private:
+		tree_type		_btree;
+		value_compare	_value_compare;
+
+	public:
+
+		explicit BTreeMap(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+			return ;
+		}
+
+		template <class InputIterator>
+			BTreeMap (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+					_btree.insert_range(first, last);
+			}
+
+		/** @brief Construct from a sorted range
+		 * [first, last) must be sorted by comp without duplicate keys, every element is then appended to the last
+		 * leaf without comparing any key, leaving full nodes behind.
+		 */
+		template <class InputIterator>
+			BTreeMap (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+					for (; first != last; ++first)
+						_btree.append(*first);
+			}
+
+		BTreeMap (const BTreeMap& x): _btree(x._btree) {
+			return ;
+		}
+
+		~BTreeMap() {
+		}
+
+		BTreeMap&	operator=(const BTreeMap& x) {
+			if (this != &x)
+				_btree = x._btree;
+			return (*this);
+		}
+
+		size_type		size() const {
+			return (_btree.size());
+		}
+
+		iterator 	begin() {
+			return (_btree.begin());
+		}
+		const_iterator begin() const {
+			return (_btree.begin());
+		}
+
+		iterator 	end() {
+			return (_btree.end());
+		}
+		const_iterator	end() const {
+			return (_btree.end());
+		}
+
+		reverse_iterator	rbegin() {
+			return (_btree.rbegin());
+		}
+		const_reverse_iterator rbegin() const {
+			return (_btree.rbegin());
+		}
+
+		reverse_iterator 	rend() {
+			return (_btree.rend());
+		}
+		const_reverse_iterator rend() const {
+			return (_btree.rend());
+		}
+
+		bool 	empty() const {
+			return (_btree.size() == 0);
+		};
+
+		size_type	max_size() const {
+			return (_btree.max_size());
+		}
+
+		mapped_type&	operator[] (const key_type& k) {
+			return (_btree.try_emplace(k).first->second);
+		}
+
+		ft::pair<iterator, bool>	insert (const value_type& val) {
+			return (_btree.insert(val));
+		}
+
+		/** @brief Insert element with a position hint
+		 * When val belongs right before position it is inserted there without searching the tree.
+		 */
+		iterator 	insert(iterator position, const value_type& val) {
+			return (_btree.insert(position, val));
+		}
+
+		/** @brief Insert element built in place unless it's key exists
+		 * Inserts a new element with key k and a mapped value constructed from args, when no element has the key k
+		 * yet. Otherwise nothing happens, args are left untouched. The tree is descended once.
+		 *
+		 * @param k The key of the element
+		 * @param args Arguments passed to the constructor of the mapped value
+		 * @return A pair with an iterator to the element with key k, and true if it was inserted
+		 */
+		template <class... Args>
+		ft::pair<iterator, bool>	try_emplace(const key_type& k, Args&&... args) {
+			return (_btree.try_emplace(k, std::forward<Args>(args)...));
+		}
+
+		/** @brief Insert element or assign to it's mapped value
+		 * Inserts a new element (k, obj) when no element has the key k, otherwise assigns obj to the mapped value of
+		 * the existing one. The tree is descended once.
+		 *
+		 * @param k The key of the element
+		 * @param obj The value to insert or assign
+		 * @return A pair with an iterator to the element with key k, and true if it was inserted, false if assigned
+		 */
+		template <class M>
+		ft::pair<iterator, bool>	insert_or_assign(const key_type& k, const M& obj) {
+			ft::pair<iterator, bool>	inserted = _btree.try_emplace(k, obj);
+
+			if (!inserted.second)
+				inserted.first->second = obj;
+			return (inserted);
+		}
+
+		template <class InputIterator>
+				void 	insert (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator() ) {
+			_btree.insert_range(first, last);
+		}
+
+		void 		erase(iterator position) {
+			_btree.erase(position);
+		}
+		size_type	erase (const key_type& k) {
+			return (_btree.erase(k));
+		}
+		void 	erase (iterator first, iterator last) {
+			_btree.erase(first, last);
+		}
+
+		void 	swap(BTreeMap& x) {
+			_btree.swap(x._btree);
+		}
+
+		void 	clear() {
+			_btree.clear();
+		}
+
+		key_compare		key_comp() const {
+			return (_btree.key_comp());
+		}
+		value_compare	value_comp() const {
+			return (_value_compare);
+		}
+
+		iterator		find(const key_type& k) {
+			return (_btree.find(k));
+		}
+		const_iterator	find(const key_type& k) const {
+			return (_btree.find(k));
+		}
+
+		size_type		count(const key_type& k) const {
+			if (_btree.find(k) != _btree.end())
+				return (1);
+			return (0);
+		}
+		iterator		lower_bound(const key_type& k) {
+			return (_btree.lower_bound(k));
+		}
+		const_iterator	lower_bound(const key_type& k) const {
+			return (_btree.lower_bound(k));
+		}
+		iterator		upper_bound(const key_type& k) {
+			return (_btree.upper_bound(k));
+		}
+		const_iterator	upper_bound(const key_type& k) const {
+			return (_btree.upper_bound(k));
+		}
+
+		ft::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const {
+			return (_btree.equal_range(k));
+		}
+		ft::pair<iterator, iterator>				equal_range(const key_type& k) {
+			return (_btree.equal_range(k));
+		}
+
+		allocator_type		get_allocator() const {
+			return (_btree.get_allocator());
+		}
+	};
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator== ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ) {
+							if (lhs.size() != rhs.size())
+								return (false);
+							return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!= ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ) {
+							return (!(lhs == rhs));
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<  ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ) {
+							return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<= ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ) {
+							return (!(rhs < lhs));
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>  ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ){
+							return (rhs < lhs);
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>= ( const ft::BTreeMap<Key,T,Compare,Alloc>& lhs,
+						const ft::BTreeMap<Key,T,Compare,Alloc>& rhs ) {
+							return (!(lhs < rhs));
+						}
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (BTreeMap<Key,T,Compare,Alloc>& x, BTreeMap<Key,T,Compare,Alloc>& y) {
+		x.swap(y);
+		return ;
+	}
+}
+
+#endif
@@ -0,0 +1,251 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BTreeSet.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/14 09:31:05 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/14 09:31:05 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+#ifndef BTREE_SET_HPP
+#define BTREE_SET_HPP
+
+# include <memory>
+# include <functional>
+# include "../utils/utils.hpp"
+# include "../utils/pair.hpp"
+# include "b_tree.hpp"
+
+namespace ft {
+	/** @brief BTreeSet
+	 * Same interface as ft::Set, over a B-tree (see b_tree.hpp) instead of a red black tree. See ft::BTreeSet:
+	 * faster lookups and walks, less memory, and any insert or erase invalidates every iterator to the set.
+	 *
+	 * @tparam T
+	 * @tparam Compare
+	 * @tparam Alloc
+	 */
+	template <class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	class BTreeSet {
+	public:
+		typedef T			value_type;
+		typedef T			key_type;
+		typedef Alloc		allocator_type;
+		typedef size_t		size_type;
+		typedef ptrdiff_t	difference_type;
+		typedef Compare		key_compare;
+		typedef Compare		value_compare;
+
+		typedef typename	allocator_type::pointer			pointer;
+		typedef typename 	allocator_type::reference 		reference;
+		typedef typename 	allocator_type::const_pointer	const_pointer;
+		typedef typename 	allocator_type::const_reference	const_reference;
+
+		// B-tree
+		typedef ft::b_tree<value_type, key_type, ft::btree_identity<value_type>, Compare, Alloc>	tree_type;
+		// Iterators
+		typedef typename tree_type::iterator						iterator;
+		typedef typename tree_type::const_iterator					const_iterator;
+		typedef typename tree_type::reverse_iterator				reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator			const_reverse_iterator;
+
+	private:
+		tree_type		_btree;
+
+	public:
+
+		explicit BTreeSet(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+			return ;
+		}
+
+		template <class InputIterator>
+			BTreeSet (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+					_btree.insert_range(first, last);
+			}
+
+		/** @brief Construct from a sorted range
+		 * [first, last) must be sorted by comp without duplicate keys, every element is then appended to the last
+		 * leaf without comparing any key, leaving full nodes behind.
+		 */
+		template <class InputIterator>
+			BTreeSet (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type()): _btree(comp, alloc) {
+					for (; first != last; ++first)
+						_btree.append(*first);
+			}
+
+		BTreeSet (const BTreeSet& x): _btree(x._btree) {
+			return ;
+		}
+
+		~BTreeSet() {
+		}
+
+		BTreeSet&	operator=(const BTreeSet& x) {
+			if (this != &x)
+				_btree = x._btree;
+			return (*this);
+		}
+
+		size_type		size() const {
+			return (_btree.size());
+		}
+
+		iterator 	begin() {
+			return (_btree.begin());
+		}
+		const_iterator begin() const {
+			return (_btree.begin());
+		}
+
+		iterator 	end() {
+			return (_btree.end());
+		}
+		const_iterator	end() const {
+			return (_btree.end());
+		}
+
+		reverse_iterator	rbegin() {
+			return (_btree.rbegin());
+		}
+		const_reverse_iterator rbegin() const {
+			return (_btree.rbegin());
+		}
+
+		reverse_iterator 	rend() {
+			return (_btree.rend());
+		}
+		const_reverse_iterator rend() const {
+			return (_btree.rend());
+		}
+
+		bool 	empty() const {
+			return (_btree.size() == 0);
+		};
+
+		size_type	max_size() const {
+			return (_btree.max_size());
+		}
+
+		ft::pair<iterator, bool>	insert (const value_type& val) {
+			return (_btree.insert(val));
+		}
+
+		/** @brief Insert element with a position hint
+		 * When val belongs right before position it is inserted there without searching the tree.
+		 */
+		iterator 	insert(iterator position, const value_type& val) {
+			return (_btree.insert(position, val));
+		}
+
+		template <class InputIterator>
+				void 	insert (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator() ) {
+			_btree.insert_range(first, last);
+		}
+
+		void 		erase(iterator position) {
+			_btree.erase(position);
+		}
+		size_type	erase (const key_type& k) {
+			return (_btree.erase(k));
+		}
+		void 	erase (iterator first, iterator last) {
+			_btree.erase(first, last);
+		}
+
+		void 	swap(BTreeSet& x) {
+			_btree.swap(x._btree);
+		}
+
+		void 	clear() {
+			_btree.clear();
+		}
+
+		key_compare		key_comp() const {
+			return (_btree.key_comp());
+		}
+		value_compare	value_comp() const {
+			return (_btree.key_comp());
+		}
+
+		iterator		find(const key_type& k) {
+			return (_btree.find(k));
+		}
+		const_iterator	find(const key_type& k) const {
+			return (_btree.find(k));
+		}
+
+		size_type		count(const key_type& k) const {
+			if (_btree.find(k) != _btree.end())
+				return (1);
+			return (0);
+		}
+		iterator		lower_bound(const key_type& k) {
+			return (_btree.lower_bound(k));
+		}
+		const_iterator	lower_bound(const key_type& k) const {
+			return (_btree.lower_bound(k));
+		}
+		iterator		upper_bound(const key_type& k) {
+			return (_btree.upper_bound(k));
+		}
+		const_iterator	upper_bound(const key_type& k) const {
+			return (_btree.upper_bound(k));
+		}
+
+		ft::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const {
+			return (_btree.equal_range(k));
+		}
+		ft::pair<iterator, iterator>				equal_range(const key_type& k) {
+			return (_btree.equal_range(k));
+		}
+
+		allocator_type		get_allocator() const {
+			return (_btree.get_allocator());
+		}
+	};
+	template <class T, class Compare, class Alloc>
+	bool operator== ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ) {
+							if (lhs.size() != rhs.size())
+								return (false);
+							return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+						}
+	template <class T, class Compare, class Alloc>
+	bool operator!= ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ) {
+							return (!(lhs == rhs));
+						}
+	template <class T, class Compare, class Alloc>
+	bool operator<  ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ) {
+							return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+						}
+	template <class T, class Compare, class Alloc>
+	bool operator<= ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ) {
+							return (!(rhs < lhs));
+						}
+	template <class T, class Compare, class Alloc>
+	bool operator>  ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ){
+							return (rhs < lhs);
+						}
+	template <class T, class Compare, class Alloc>
+	bool operator>= ( const ft::BTreeSet<T,Compare,Alloc>& lhs,
+						const ft::BTreeSet<T,Compare,Alloc>& rhs ) {
+							return (!(lhs < rhs));
+						}
+	template <class T, class Compare, class Alloc>
+	void swap (BTreeSet<T,Compare,Alloc>& x, BTreeSet<T,Compare,Alloc>& y) {
+		x.swap(y);
+		return ;
+	}
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* ************************************************************************************************ */
+/*                                                                                                  */
+/*   BTree_bench.cpp                                                                                */
+/*                                                                                                  */
+/*   Compares std::map, ft::Map and ft::BTreeMap on an index of small keys: random inserts, lookup  */
+/*   hits in random order, an in-order walk, and the memory held by the container once filled,     */
+/*   counted by an allocator that tracks the bytes it hands out.                                    */
+/*                                                                                                  */
+/*   usage: ./BTree_bench [keys] [lookups]                                                          */
+/*                                                                                                  */
+/* ************************************************************************************************ */
+# include <map>
+# include <memory>
+# include <iostream>
+# include <iomanip>
+# include <cstdlib>
+# include <stdint.h>
+# include <sys/time.h>
+# include "BTreeMap.hpp"
+# include "../Map/Map.hpp"
+
+# define DEFAULT_KEYS 1000000
+# define DEFAULT_LOOKUPS 4000000
+
+size_t  live_bytes = 0;
+
+template <class T>
+struct counting_allocator : std::allocator<T> {
+    template <class U> struct rebind {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator() {}
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T*      allocate(size_t n, const void* = 0) {
+        live_bytes += n * sizeof(T);
+        return (std::allocator<T>::allocate(n));
+    }
+    void    deallocate(T* p, size_t n) {
+        live_bytes -= n * sizeof(T);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+double get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    return ((time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3));
+}
+
+uint64_t    next_key(uint64_t& state)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (state >> 24);
+}
+
+template <class Container>
+void    index_load(const char *name, size_t keys, size_t lookups)
+{
+    Container   index;
+    uint64_t    state = 1;
+    double      start = get_time();
+
+    for (size_t i = 0; i < keys; ++i)
+        index[next_key(state)] = i;
+    double      filled = get_time();
+    size_t      bytes = live_bytes;
+    uint64_t    checksum = 0;
+
+    for (size_t i = 0; i < lookups; ++i) {
+        if (i % keys == 0)
+            state = 1;
+        checksum += index.find(next_key(state))->second;
+    }
+    double      found = get_time();
+
+    for (typename Container::iterator it = index.begin(); it != index.end(); ++it)
+        checksum += it->second;
+    double      walked = get_time();
+
+    std::cout << std::setw(18) << std::left << name
+              << std::setw(12) << std::right << std::fixed << std::setprecision(1) << (filled - start)
+              << std::setw(14) << (found - filled)
+              << std::setw(14) << std::setprecision(2) << (lookups / ((found - filled) * 1e3))
+              << std::setw(12) << std::setprecision(1) << (walked - found)
+              << std::setw(14) << std::setprecision(1) << (double)bytes / keys
+              << std::setw(12) << checksum % 1000 << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  keys = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : DEFAULT_KEYS;
+    size_t  lookups = (argc > 2) ? std::strtoul(argv[2], NULL, 10) : DEFAULT_LOOKUPS;
+
+    if (keys == 0)
+        keys = 1;
+    std::cout << "\033[1;36m" << keys << " uint64_t -> uint32_t keys, " << lookups << " lookup hits\033[0m\n\n";
+    std::cout << std::setw(18) << std::left << "container"
+              << std::setw(12) << std::right << "fill (ms)"
+              << std::setw(14) << "lookup (ms)"
+              << std::setw(14) << "Mlookups/s"
+              << std::setw(12) << "walk (ms)"
+              << std::setw(14) << "bytes/key"
+              << std::setw(12) << "checksum" << std::endl;
+    index_load<std::map<uint64_t, uint32_t, std::less<uint64_t>, counting_allocator<std::pair<const uint64_t, uint32_t> > > >
+        ("std::map", keys, lookups);
+    index_load<ft::Map<uint64_t, uint32_t, std::less<uint64_t>, counting_allocator<ft::pair<const uint64_t, uint32_t> > > >
+        ("ft::Map", keys, lookups);
+    index_load<ft::BTreeMap<uint64_t, uint32_t, std::less<uint64_t>, counting_allocator<ft::pair<const uint64_t, uint32_t> > > >
+        ("ft::BTreeMap", keys, lookups);
+    return (0);
+}
@@ -0,0 +1,504 @@
+//
+// Created by mashad on 14/12/2021.
+//
+
+#include "BTreeMap.hpp"
+#include "BTreeSet.hpp"
+#include "../utils/pair.hpp"
+#include <map>
+#include <set>
+#include <vector>
+#include <memory>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 20 // the ft::BTreeMap methods can be slower up to std::map methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename Iter1, typename Iter2>
+bool compareMaps(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2)
+{
+    for (; (first1 != last1) && (first2 != last2); ++first1, ++first2)
+        if (first1->first != first2->first || first1->second != first2->second)
+            return false;
+    return (first1 == last1) && (first2 == last2);
+}
+
+template <typename Iter1, typename Iter2>
+bool compareSets(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2)
+{
+    for (; (first1 != last1) && (first2 != last2); ++first1, ++first2)
+        if (*first1 != *first2)
+            return false;
+    return (first1 == last1) && (first2 == last2);
+}
+
+/*
+ * std::less counting the comparisons it makes
+ */
+size_t comparisons = 0;
+
+struct counting_less
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        comparisons++;
+        return lhs < rhs;
+    }
+};
+
+/*
+ * A value counting the copies made of it
+ */
+size_t copies = 0;
+
+struct Counted
+{
+    int n;
+
+    Counted(int x = 0) : n(x) {}
+    Counted(const Counted &x) : n(x.n) { copies++; }
+    Counted(Counted &&x) : n(x.n) {}
+    Counted &operator=(const Counted &x) { n = x.n; copies++; return (*this); }
+};
+
+void testMapConstructors()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " empty, range and copy constructors "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, std::string> m1;
+        ft::BTreeMap<int, std::string> ft_m1;
+
+        for (int i = 0; i < 1000; i++)
+        {
+            m1.insert(std::make_pair((i * 7919) % 1000, std::to_string(i)));
+            ft_m1.insert(ft::make_pair((i * 7919) % 1000, std::to_string(i)));
+        }
+        std::map<int, std::string> m2(m1.begin(), m1.end());
+        ft::BTreeMap<int, std::string> ft_m2(ft_m1.begin(), ft_m1.end());
+        std::map<int, std::string> m3(m1.rbegin(), m1.rend());
+        ft::BTreeMap<int, std::string> ft_m3(ft_m1.rbegin(), ft_m1.rend());
+        std::map<int, std::string> m4(m2);
+        ft::BTreeMap<int, std::string> ft_m4(ft_m2);
+        ft::BTreeMap<int, std::string> ft_m5;
+        ft::BTreeMap<int, std::string> ft_m6;
+
+        ft_m5 = ft_m4;
+        ft_m5 = ft_m6;
+        ft_m6 = ft_m4;
+        EQUAL(compareMaps(m1.begin(), m1.end(), ft_m1.begin(), ft_m1.end()) && compareMaps(m2.begin(), m2.end(), ft_m2.begin(), ft_m2.end())
+              && compareMaps(m3.begin(), m3.end(), ft_m3.begin(), ft_m3.end()) && compareMaps(m4.begin(), m4.end(), ft_m4.begin(), ft_m4.end())
+              && ft_m5.empty() && compareMaps(m4.begin(), m4.end(), ft_m6.begin(), ft_m6.end()));
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " sorted range constructor "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::vector<ft::pair<int, int> > v;
+        std::map<int, int> m;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            v.push_back(ft::make_pair(i * 3, i));
+            m.insert(std::make_pair(i * 3, i));
+        }
+        comparisons = 0;
+        ft::BTreeMap<int, int, counting_less> ft_m(ft::sorted_unique, v.begin(), v.end());
+        std::vector<int> keys;
+
+        for (size_t i = 0; i < v.size(); i++)
+            keys.push_back(v[i].first);
+        ft::BTreeSet<int, counting_less> ft_s(ft::sorted_unique, keys.begin(), keys.end());
+        bool cond = (comparisons == 0 && compareSets(keys.begin(), keys.end(), ft_s.begin(), ft_s.end()));
+
+        ft_m.insert(ft::make_pair(1, 1));
+        m.insert(std::make_pair(1, 1));
+        EQUAL(cond && compareMaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && ft_m.size() == m.size());
+    }
+}
+
+void testMapIterators()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " iterators both ways "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::BTreeMap<int, int> ft_m;
+        bool cond = (ft_m.begin() == ft_m.end()) && (ft_m.rbegin() == ft_m.rend());
+
+        for (int i = 0; i < 10000; i++)
+        {
+            m[(i * 7919) % 10007] = i;
+            ft_m[(i * 7919) % 10007] = i;
+        }
+        std::map<int, int>::reverse_iterator rit = m.rbegin();
+        ft::BTreeMap<int, int>::reverse_iterator ft_rit = ft_m.rbegin();
+
+        for (; rit != m.rend() && ft_rit != ft_m.rend(); ++rit, ++ft_rit)
+            cond = cond && rit->first == ft_rit->first && rit->second == ft_rit->second;
+        cond = cond && rit == m.rend() && ft_rit == ft_m.rend();
+
+        std::map<int, int>::iterator it = m.end();
+        ft::BTreeMap<int, int>::iterator ft_it = ft_m.end();
+
+        while (it != m.begin())
+        {
+            --it;
+            --ft_it;
+            cond = cond && it->first == ft_it->first;
+        }
+        cond = cond && ft_it == ft_m.begin() && (++ft_m.rbegin())->first == (++m.rbegin())->first;
+
+        const ft::BTreeMap<int, int> c_ft_m(ft_m);
+        ft::BTreeMap<int, int>::const_iterator c_it = c_ft_m.begin();
+        ft::BTreeMap<int, int>::const_reverse_iterator c_rit = c_ft_m.rbegin();
+
+        cond = cond && c_it->first == m.begin()->first && c_rit->first == m.rbegin()->first;
+        EQUAL(cond && compareMaps(m.begin(), m.end(), c_ft_m.begin(), c_ft_m.end()));
+    }
+}
+
+void testMapModifiers()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert and insert with hint "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, std::string> m;
+        ft::BTreeMap<int, std::string> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 3000; i++)
+        {
+            std::pair<std::map<int, std::string>::iterator, bool> res = m.insert(std::make_pair((i * 37) % 1000, std::to_string(i)));
+            ft::pair<ft::BTreeMap<int, std::string>::iterator, bool> ft_res = ft_m.insert(ft::make_pair((i * 37) % 1000, std::to_string(i)));
+
+            cond = cond && res.second == ft_res.second && res.first->second == ft_res.first->second;
+        }
+        for (int i = 1000; i < 3000; i++)
+        {
+            m.insert(m.end(), std::make_pair(i, "end"));
+            ft_m.insert(ft_m.end(), ft::make_pair(i, "end"));
+            m.insert(m.begin(), std::make_pair(-i, "begin"));
+            ft_m.insert(ft_m.begin(), ft::make_pair(-i, "begin"));
+            m.insert(m.find(i / 2), std::make_pair(i * 2, "wrong hint"));
+            ft_m.insert(ft_m.find(i / 2), ft::make_pair(i * 2, "wrong hint"));
+        }
+        EQUAL(cond && compareMaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " operator [], try_emplace, assign "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, std::string> m;
+        ft::BTreeMap<int, std::string> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 2000; i++)
+        {
+            m[i % 700] += "x";
+            ft_m[i % 700] += "x";
+        }
+        cond = cond && ft_m.try_emplace(1, "no").second == false && ft_m[1] == m[1];
+        cond = cond && ft_m.try_emplace(5000, 3, 'c').second == true && ft_m[5000] == "ccc";
+        cond = cond && ft_m.insert_or_assign(5000, "d").second == false && ft_m[5000] == "d";
+        cond = cond && ft_m.insert_or_assign(5001, "e").second == true && ft_m[5001] == "e";
+        m[5000] = "d";
+        m[5001] = "e";
+        EQUAL(cond && compareMaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()));
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " try_emplace builds values in place "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::BTreeMap<int, Counted> ft_m;
+        bool cond = true;
+
+        // the mapped value is constructed right in it's slot, then moved by the shifts and splits of a descending run
+        copies = 0;
+        for (int i = 1000; i > 0; --i)
+            cond = cond && ft_m.try_emplace(i, i).second == true;
+        cond = cond && ft_m.try_emplace(1, 0).second == false && ft_m[1].n == 1 && ft_m[1000].n == 1000;
+        for (int i = 1; i <= 1000; i += 2)
+            ft_m.erase(i);
+        cond = cond && ft_m[2].n == 2 && ft_m.size() == 500;
+
+        // a move-only mapped value
+        ft::BTreeMap<int, std::unique_ptr<int> > ft_u;
+        int sum = 0;
+
+        for (int i = 1000; i > 0; --i)
+            ft_u.try_emplace(i, new int(i));
+        for (int i = 1; i <= 1000; i += 2)
+            ft_u.erase(i);
+        for (ft::BTreeMap<int, std::unique_ptr<int> >::iterator it = ft_u.begin(); it != ft_u.end(); ++it)
+            sum += *it->second;
+        EQUAL(cond && copies == 0 && ft_u.size() == 500 && sum == 250500 && *ft_u[2] == 2);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase by key and position "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::BTreeMap<int, int> ft_m;
+        std::mt19937 gen(42);
+        bool cond = true;
+
+        for (int i = 0; i < 20000; i++)
+        {
+            int key = gen() % 5000;
+
+            m[key] = i;
+            ft_m[key] = i;
+        }
+        for (int i = 0; i < 20000; i++)
+        {
+            int key = gen() % 5000;
+
+            if (i % 2)
+                cond = cond && m.erase(key) == ft_m.erase(key);
+            else if (ft_m.find(key) != ft_m.end())
+            {
+                m.erase(m.find(key));
+                ft_m.erase(ft_m.find(key));
+            }
+            if (i % 3 == 0)
+            {
+                m[key * 2] = i;
+                ft_m[key * 2] = i;
+            }
+        }
+        EQUAL(cond && compareMaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase ranges "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::BTreeMap<int, int> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 10000; i++)
+        {
+            m[i] = i;
+            ft_m[i] = i;
+        }
+        for (int i = 0; i < 50; i++)
+        {
+            int first = (i * 7919) % 10000;
+
+            m.erase(m.lower_bound(first), m.lower_bound(first + i * 10));
+            ft_m.erase(ft_m.lower_bound(first), ft_m.lower_bound(first + i * 10));
+            cond = cond && m.size() == ft_m.size();
+        }
+        m.erase(m.begin(), m.find(5000));
+        ft_m.erase(ft_m.begin(), ft_m.find(5000));
+        m.erase(m.find(9000), m.end());
+        ft_m.erase(ft_m.find(9000), ft_m.end());
+        cond = cond && compareMaps(m.begin(), m.end(), ft_m.begin(), ft_m.end());
+        ft_m.erase(ft_m.begin(), ft_m.end());
+        EQUAL(cond && ft_m.empty() && ft_m.begin() == ft_m.end());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " swap and clear "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::BTreeMap<int, int> ft_m1;
+        ft::BTreeMap<int, int> ft_m2;
+
+        for (int i = 0; i < 1000; i++)
+            ft_m1[i] = i;
+        ft::BTreeMap<int, int>::iterator it = ft_m1.begin();
+
+        swap(ft_m1, ft_m2);
+        bool cond = ft_m1.empty() && ft_m2.size() == 1000 && it == ft_m2.begin();
+
+        ft_m2.clear();
+        ft_m2[3] = 3;
+        EQUAL(cond && ft_m2.size() == 1 && ft_m2.begin()->first == 3);
+    }
+}
+
+void testMapOperations()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " find, count, bounds, equal_range "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::BTreeMap<int, int> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            m[i * 2] = i;
+            ft_m[i * 2] = i;
+        }
+        const ft::BTreeMap<int, int> &c_ft_m = ft_m;
+
+        for (int k = -3; k < 10003; k++)
+        {
+            std::map<int, int>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+            ft::BTreeMap<int, int>::iterator ft_lb = ft_m.lower_bound(k), ft_ub = ft_m.upper_bound(k);
+            ft::pair<ft::BTreeMap<int, int>::const_iterator, ft::BTreeMap<int, int>::const_iterator> ft_range = c_ft_m.equal_range(k);
+
+            cond = cond && (lb == m.end()) == (ft_lb == ft_m.end()) && (lb == m.end() || lb->first == ft_lb->first);
+            cond = cond && (ub == m.end()) == (ft_ub == ft_m.end()) && (ub == m.end() || ub->first == ft_ub->first);
+            cond = cond && ft_range.first == c_ft_m.lower_bound(k) && ft_range.second == c_ft_m.upper_bound(k);
+            cond = cond && m.count(k) == ft_m.count(k) && (m.find(k) == m.end()) == (c_ft_m.find(k) == c_ft_m.end());
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " find time limit "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::map<int, int> m;
+        ft::BTreeMap<int, int> ft_m;
+        long long sum = 0, ft_sum = 0;
+
+        for (int i = 0; i < 1e6; i++)
+        {
+            m[i] = i;
+            ft_m[i] = i;
+        }
+        start = get_time();
+        for (int i = 0; i < 1e6; i++)
+            sum += m.find((i * 7919LL) % 1000000)->second;
+        end = get_time();
+        diff = end - start;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e6; i++)
+            ft_sum += ft_m.find((i * 7919LL) % 1000000)->second;
+        ualarm(0, 0);
+        EQUAL(sum == ft_sum);
+    }
+}
+
+void testMapRelationalOperators()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " relational operators "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<char, int> foo, bar;
+        ft::BTreeMap<char, int> ft_foo, ft_bar;
+
+        foo['a'] = 100;
+        foo['b'] = 200;
+        bar['a'] = 10;
+        bar['z'] = 1000;
+        ft_foo['a'] = 100;
+        ft_foo['b'] = 200;
+        ft_bar['a'] = 10;
+        ft_bar['z'] = 1000;
+        ft::BTreeMap<char, int> ft_copy(ft_foo);
+
+        EQUAL((foo == bar) == (ft_foo == ft_bar) && (foo != bar) == (ft_foo != ft_bar) && (foo < bar) == (ft_foo < ft_bar)
+              && (foo > bar) == (ft_foo > ft_bar) && (foo <= bar) == (ft_foo <= ft_bar) && (foo >= bar) == (ft_foo >= ft_bar)
+              && ft_foo == ft_copy);
+    }
+}
+
+void testSet()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert, erase and iterators "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::BTreeSet<int> ft_s;
+        std::mt19937 gen(7);
+        bool cond = true;
+
+        for (int i = 0; i < 50000; i++)
+        {
+            int key = gen() % 20000;
+
+            if (i % 3 == 2)
+                cond = cond && s.erase(key) == ft_s.erase(key);
+            else
+                cond = cond && s.insert(key).second == ft_s.insert(key).second;
+        }
+        cond = cond && compareSets(s.rbegin(), s.rend(), ft_s.rbegin(), ft_s.rend());
+        s.erase(s.lower_bound(5000), s.upper_bound(15000));
+        ft_s.erase(ft_s.lower_bound(5000), ft_s.upper_bound(15000));
+        EQUAL(cond && compareSets(s.begin(), s.end(), ft_s.begin(), ft_s.end()) && s.size() == ft_s.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " strings, bounds and copies "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<std::string> s;
+        ft::BTreeSet<std::string> ft_s;
+        bool cond = true;
+
+        for (int i = 0; i < 3000; i++)
+        {
+            s.insert(std::to_string(i * 13));
+            ft_s.insert(ft_s.end(), std::to_string(i * 13));
+        }
+        const ft::BTreeSet<std::string> c_ft_s(ft_s.begin(), ft_s.end());
+
+        for (int i = 0; i < 3000; i += 7)
+        {
+            std::string key = std::to_string(i);
+            std::set<std::string>::iterator lb = s.lower_bound(key);
+            ft::BTreeSet<std::string>::const_iterator ft_lb = c_ft_s.lower_bound(key);
+
+            cond = cond && (lb == s.end() ? ft_lb == c_ft_s.end() : *lb == *ft_lb) && s.count(key) == c_ft_s.count(key);
+        }
+        ft::BTreeSet<std::string> ft_copy;
+
+        ft_copy = c_ft_s;
+        ft_copy.erase(ft_copy.begin());
+        EQUAL(cond && c_ft_s == ft_s && ft_copy != ft_s && ft_s < ft_copy && compareSets(s.begin(), s.end(), c_ft_s.begin(), c_ft_s.end()));
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing BTreeMap;" << RESET << std::endl;
+    TEST_CASE(testMapConstructors);
+    TEST_CASE(testMapIterators);
+    TEST_CASE(testMapModifiers);
+    TEST_CASE(testMapOperations);
+    TEST_CASE(testMapRelationalOperators);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing BTreeSet;" << RESET << std::endl;
+    TEST_CASE(testSet);
+    std::cout << std::endl;
+    return 0;
+}
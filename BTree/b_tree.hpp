@@ -0,0 +1,878 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   b_tree.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/14 09:31:05 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/14 09:31:05 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+#ifndef B_TREE_HPP
+#define B_TREE_HPP
+
+# include <cstddef>
+# include <memory>
+# include <type_traits>
+# include <utility>
+# include "../Vector/iterator_traits.hpp"
+# include "../Vector/reverse_iterator.hpp"
+# include "../utils/utils.hpp"
+# include "../utils/pair.hpp"
+
+namespace ft {
+	/*
+	 * Key extractors: a B-tree of pairs orders them by their first member, a B-tree of keys by the keys themselves.
+	 */
+	template <class Pair>
+	struct btree_select_first {
+		const typename Pair::first_type&	operator()(const Pair& x) const {
+			return (x.first);
+		}
+	};
+	template <class T>
+	struct btree_identity {
+		const T&	operator()(const T& x) const {
+			return (x);
+		}
+	};
+
+	template <class Value, size_t Slots> struct btree_internal_node;
+
+	/** @brief B-tree node
+	 * A node holds up to Slots values side by side, in order, right after it's few bytes of bookkeeping: a search
+	 * compares keys that share the node's cache lines instead of chasing one pointer per key. Leaves stop there;
+	 * internal nodes (see btree_internal_node) go on with the links to their Slots + 1 children.
+	 *
+	 * The slots are raw storage: only the first count of them hold values.
+	 */
+	template <class Value, size_t Slots>
+	struct btree_node {
+		typedef Value							value_type;
+		typedef btree_node*						node_pointer;
+		typedef btree_internal_node<Value, Slots>	internal_type;
+
+		node_pointer	parent;
+		unsigned short	position;
+		unsigned short	count;
+		bool			leaf;
+		typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type	slots[Slots];
+
+		value_type&			value(size_t i) {
+			return (*reinterpret_cast<value_type*>(&slots[i]));
+		}
+		const value_type&	value(size_t i) const {
+			return (*reinterpret_cast<const value_type*>(&slots[i]));
+		}
+		node_pointer&		child(size_t i);
+	};
+
+	template <class Value, size_t Slots>
+	struct btree_internal_node : btree_node<Value, Slots> {
+		btree_node<Value, Slots>	*children[Slots + 1];
+	};
+
+	template <class Value, size_t Slots>
+	typename btree_node<Value, Slots>::node_pointer&	btree_node<Value, Slots>::child(size_t i) {
+		return (static_cast<internal_type*>(this)->children[i]);
+	}
+
+	/** @brief B-tree iterator
+	 * A node and a slot in it. end() is the slot right after the last value of the rightmost leaf, and stepping
+	 * back from begin() gives the slot right before the first value of the leftmost leaf (the base of rend()).
+	 */
+	template <class T, class Node>
+	class btree_iterator {
+		public:
+			typedef T								value_type;
+			typedef value_type*						pointer;
+			typedef value_type&						reference;
+			typedef ptrdiff_t						difference_type;
+			typedef Node							node_type;
+			typedef node_type*						node_pointer;
+
+			typedef std::bidirectional_iterator_tag	iterator_category;
+
+		private:
+			node_pointer	_node;
+			int				_position;
+
+		public:
+			btree_iterator(): _node(nullptr), _position(0) {
+				return ;
+			}
+
+			btree_iterator(node_pointer dnode, int position) : _node(dnode), _position(position) {
+				return ;
+			}
+
+			btree_iterator(const btree_iterator& x) : _node(x._node), _position(x._position) {
+				return ;
+			}
+
+			btree_iterator&	operator=(const btree_iterator& x) {
+				_node = x._node;
+				_position = x._position;
+				return (*this);
+			}
+
+			reference 	operator*() const {
+				return (_node->value(_position));
+			}
+			pointer	operator->() const {
+				return (&(operator*()));
+			}
+			node_pointer	getNode() const {
+				return (_node);
+			}
+			int				getPosition() const {
+				return (_position);
+			}
+
+			/*
+			 * In a leaf the next value is the next slot, unless the leaf is done: then it's the separator right of
+			 * the first ancestor not left through it's last child. In an internal node it's the first value of
+			 * the leftmost leaf under the next child.
+			 */
+			btree_iterator	operator++() {
+				if (_node == nullptr)
+					return (*this);
+				if (_node->leaf) {
+					if (_position + 1 < _node->count) {
+						++_position;
+						return (*this);
+					}
+					node_pointer	node = _node;
+					int				position = _node->count;
+
+					while (position == node->count && node->parent != nullptr) {
+						position = node->position;
+						node = node->parent;
+					}
+					if (position < node->count) {
+						_node = node;
+						_position = position;
+					} else
+						_position = _node->count;
+					return (*this);
+				}
+				_node = _node->child(_position + 1);
+				while (!_node->leaf)
+					_node = _node->child(0);
+				_position = 0;
+				return (*this);
+			}
+
+			btree_iterator	operator++(int) {
+				btree_iterator tmp = *this;
+
+				++(*this);
+				return (tmp);
+			}
+
+			btree_iterator	operator--() {
+				if (_node == nullptr)
+					return (*this);
+				if (_node->leaf) {
+					if (_position > 0) {
+						--_position;
+						return (*this);
+					}
+					node_pointer	node = _node;
+					int				position = 0;
+
+					while (position == 0 && node->parent != nullptr) {
+						position = node->position;
+						node = node->parent;
+					}
+					if (position == 0)
+						_position = -1;
+					else {
+						_node = node;
+						_position = position - 1;
+					}
+					return (*this);
+				}
+				_node = _node->child(_position);
+				while (!_node->leaf)
+					_node = _node->child(_node->count);
+				_position = _node->count - 1;
+				return (*this);
+			}
+			btree_iterator	operator--(int) {
+				btree_iterator tmp = *this;
+
+				--(*this);
+				return (tmp);
+			}
+
+			friend bool		operator==(const btree_iterator& lhs, const btree_iterator& rhs) {
+				return (lhs._node == rhs._node && lhs._position == rhs._position);
+			}
+			friend bool 	operator!=(const btree_iterator& lhs, const btree_iterator& rhs) {
+				return (!(lhs == rhs));
+			}
+
+			operator		btree_iterator<const value_type, node_type> () const {
+				return (btree_iterator<const value_type, node_type>(_node, _position));
+			}
+	};
+
+	/** @brief B-tree
+	 * Ordered container of unique keys, the base of ft::BTreeMap and ft::BTreeSet. Values are stored in nodes of
+	 * about NodeBytes bytes (see btree_node), so a lookup touches a few cache lines per level over a tree a
+	 * handful of levels high, and small values take a fraction of the memory of one allocation each.
+	 *
+	 * Full nodes are split on insert, the split being biased toward the side being inserted at so that sorted
+	 * insertions leave full nodes behind. Nodes less than half full after an erase are merged with a sibling, or
+	 * take values from it. Values move between slots and nodes on both, so unlike the red black tree's, inserting
+	 * or erasing an element invalidates every iterator.
+	 *
+	 * @tparam Value Type of the elements
+	 * @tparam KeyOfValue Function object returning the key of an element
+	 * @tparam NodeBytes Approximate size of a leaf node
+	 */
+	template <class Value, class Key, class KeyOfValue, class Compare, class Alloc, size_t NodeBytes = 256>
+	class b_tree {
+		public:
+			typedef Key								key_type;
+			typedef Value							value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+			typedef size_t							size_type;
+			typedef ptrdiff_t						difference_type;
+
+			static const size_type	slots = ((NodeBytes - 2 * sizeof(void*)) / sizeof(value_type) > 3)
+				? (((NodeBytes - 2 * sizeof(void*)) / sizeof(value_type) < 1024) ? (NodeBytes - 2 * sizeof(void*)) / sizeof(value_type) : 1024)
+				: 3;
+
+			typedef ft::btree_node<value_type, slots>				node_type;
+			typedef node_type*										node_pointer;
+			typedef ft::btree_internal_node<value_type, slots>		internal_type;
+			typedef typename allocator_type::template rebind<node_type>::other		leaf_allocator;
+			typedef typename allocator_type::template rebind<internal_type>::other	internal_allocator;
+			typedef ft::btree_iterator<value_type, node_type>		iterator;
+			typedef ft::btree_iterator<const value_type, node_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		private:
+			static const size_type	_min = slots / 2;
+
+			node_pointer		_root;
+			node_pointer		_leftmost;
+			node_pointer		_rightmost;
+			size_type			_size;
+			allocator_type		_alloc;
+			leaf_allocator		_leaf_allocator;
+			internal_allocator	_internal_allocator;
+			key_compare			_compare;
+
+			const key_type&	_key(node_pointer node, size_type i) const {
+				return (KeyOfValue()(node->value(i)));
+			}
+
+			node_pointer	_newNode(bool leaf) {
+				node_pointer	node;
+
+				if (leaf)
+					node = _leaf_allocator.allocate(1);
+				else
+					node = _internal_allocator.allocate(1);
+				node->parent = nullptr;
+				node->position = 0;
+				node->count = 0;
+				node->leaf = leaf;
+				return (node);
+			}
+			void	_deleteNode(node_pointer node) {
+				if (node->leaf)
+					_leaf_allocator.deallocate(node, 1);
+				else
+					_internal_allocator.deallocate(static_cast<internal_type*>(node), 1);
+			}
+
+			static void	_setChild(node_pointer node, size_type i, node_pointer child) {
+				node->child(i) = child;
+				child->parent = node;
+				child->position = i;
+			}
+
+			/** @brief Move the value at src to the empty slot dst, leaving src empty */
+			void	_relocate(value_type* dst, value_type* src) {
+				_alloc.construct(dst, std::move(*src));
+				_alloc.destroy(src);
+			}
+
+			/** @brief Index of the first key of node not less than key */
+			size_type	_lowerIndex(node_pointer node, const key_type& key) const {
+				size_type	first = 0;
+				size_type	last = node->count;
+
+				while (first < last) {
+					size_type	middle = (first + last) / 2;
+
+					if (_compare(_key(node, middle), key))
+						first = middle + 1;
+					else
+						last = middle;
+				}
+				return (first);
+			}
+			/** @brief Index of the first key of node greater than key */
+			size_type	_upperIndex(node_pointer node, const key_type& key) const {
+				size_type	first = 0;
+				size_type	last = node->count;
+
+				while (first < last) {
+					size_type	middle = (first + last) / 2;
+
+					if (_compare(key, _key(node, middle)))
+						last = middle;
+					else
+						first = middle + 1;
+				}
+				return (first);
+			}
+
+			/** @brief Find key, or the leaf slot it belongs to
+			 * @return Whether key was found; node and i are set to it's slot, or to the slot a value with that key
+			 * has to be inserted at.
+			 */
+			bool	_descend(const key_type& key, node_pointer& node, size_type& i) const {
+				node = _root;
+				while (true) {
+					i = _lowerIndex(node, key);
+					if (i < node->count && !_compare(key, _key(node, i)))
+						return (true);
+					if (node->leaf)
+						return (false);
+					node = node->child(i);
+				}
+			}
+
+			/** @brief Insert a value constructed from args at slot i of leaf, splitting it first when full */
+			template <class... Args>
+			iterator	_insertLeaf(node_pointer node, size_type i, Args&&... args) {
+				if (node->count == slots)
+					_split(node, i);
+				for (size_type j = node->count; j > i; --j)
+					_relocate(&node->value(j), &node->value(j - 1));
+				_alloc.construct(&node->value(i), std::forward<Args>(args)...);
+				node->count++;
+				_size++;
+				return (iterator(node, i));
+			}
+
+			/** @brief Split the full node, about to get a value at slot i
+			 * The values after a median go to a new right sibling and the median moves up to the parent, itself split
+			 * first when full; a full root gets a new root above it. The split puts as few values as possible on the
+			 * side of i when i is at either end of the node, none at all when appending. node and i are set to where
+			 * the value has to go.
+			 */
+			void	_split(node_pointer& node, size_type& i) {
+				if (node->parent == nullptr) {
+					node_pointer	root = _newNode(false);
+
+					_setChild(root, 0, node);
+					_root = root;
+				} else if (node->parent->count == slots) {
+					size_type	position = node->position;
+					node_pointer	parent = node->parent;
+
+					_split(parent, position);
+				}
+				node_pointer	parent = node->parent;
+				size_type		right = (i == 0) ? slots - 1 : (i == slots) ? 0 : slots / 2;
+				size_type		left = slots - 1 - right;
+				node_pointer	sibling = _newNode(node->leaf);
+
+				for (size_type j = 0; j < right; ++j)
+					_relocate(&sibling->value(j), &node->value(left + 1 + j));
+				if (!node->leaf)
+					for (size_type j = 0; j <= right; ++j)
+						_setChild(sibling, j, node->child(left + 1 + j));
+				sibling->count = right;
+				node->count = left;
+
+				size_type	position = node->position;
+
+				for (size_type j = parent->count; j > position; --j)
+					_relocate(&parent->value(j), &parent->value(j - 1));
+				for (size_type j = parent->count + 1; j > position + 1; --j)
+					_setChild(parent, j, parent->child(j - 1));
+				_relocate(&parent->value(position), &node->value(left));
+				_setChild(parent, position + 1, sibling);
+				parent->count++;
+				if (node == _rightmost)
+					_rightmost = sibling;
+				if (i > left) {
+					node = sibling;
+					i -= left + 1;
+				}
+			}
+
+			/** @brief Merge right, and the separator between them, into it's left sibling left */
+			void	_merge(node_pointer left, node_pointer right) {
+				node_pointer	parent = left->parent;
+				size_type		position = left->position;
+				size_type		count = left->count;
+
+				_relocate(&left->value(count), &parent->value(position));
+				for (size_type j = 0; j < right->count; ++j)
+					_relocate(&left->value(count + 1 + j), &right->value(j));
+				if (!left->leaf)
+					for (size_type j = 0; j <= right->count; ++j)
+						_setChild(left, count + 1 + j, right->child(j));
+				left->count += 1 + right->count;
+				for (size_type j = position; j + 1 < parent->count; ++j)
+					_relocate(&parent->value(j), &parent->value(j + 1));
+				for (size_type j = position + 1; j < parent->count; ++j)
+					_setChild(parent, j, parent->child(j + 1));
+				parent->count--;
+				if (right == _rightmost)
+					_rightmost = left;
+				_deleteNode(right);
+			}
+
+			/** @brief Move n values from the front of right to the back of it's left sibling left, through the parent */
+			void	_shiftLeft(node_pointer left, node_pointer right, size_type n) {
+				node_pointer	parent = left->parent;
+				size_type		position = left->position;
+				size_type		count = left->count;
+
+				_relocate(&left->value(count), &parent->value(position));
+				for (size_type j = 0; j + 1 < n; ++j)
+					_relocate(&left->value(count + 1 + j), &right->value(j));
+				_relocate(&parent->value(position), &right->value(n - 1));
+				for (size_type j = 0; j + n < right->count; ++j)
+					_relocate(&right->value(j), &right->value(j + n));
+				if (!left->leaf) {
+					for (size_type j = 0; j < n; ++j)
+						_setChild(left, count + 1 + j, right->child(j));
+					for (size_type j = 0; j + n <= right->count; ++j)
+						_setChild(right, j, right->child(j + n));
+				}
+				left->count += n;
+				right->count -= n;
+			}
+
+			/** @brief Move n values from the back of left to the front of it's right sibling right, through the parent */
+			void	_shiftRight(node_pointer left, node_pointer right, size_type n) {
+				node_pointer	parent = left->parent;
+				size_type		position = left->position;
+				size_type		count = left->count;
+
+				for (size_type j = right->count; j > 0; --j)
+					_relocate(&right->value(j - 1 + n), &right->value(j - 1));
+				_relocate(&right->value(n - 1), &parent->value(position));
+				for (size_type j = 0; j + 1 < n; ++j)
+					_relocate(&right->value(j), &left->value(count - n + 1 + j));
+				_relocate(&parent->value(position), &left->value(count - n));
+				if (!right->leaf) {
+					for (size_type j = right->count + 1; j > 0; --j)
+						_setChild(right, j - 1 + n, right->child(j - 1));
+					for (size_type j = 0; j < n; ++j)
+						_setChild(right, j, left->child(count - n + 1 + j));
+				}
+				left->count -= n;
+				right->count += n;
+			}
+
+			/** @brief Iterator to slot i of node, a slot past the last value standing for the value after it */
+			iterator	_normalize(node_pointer node, size_type i) const {
+				while (i == node->count && node->parent != nullptr) {
+					i = node->position;
+					node = node->parent;
+				}
+				if (i == node->count)
+					return (iterator(_rightmost, _rightmost->count));
+				return (iterator(node, i));
+			}
+
+			/** @brief Erase the value at slot i of node
+			 * A value of an internal node is replaced by it's in-order predecessor, taken from the end of a leaf. Going
+			 * up from the leaf, a node less than half full is merged with a sibling when both fit in one node, or
+			 * takes half of the sibling's surplus otherwise. The slot of the next value is tracked through the moves.
+			 *
+			 * @return An iterator to the value that followed the erased one
+			 */
+			iterator	_erase(node_pointer node, size_type i) {
+				bool	internal = !node->leaf;
+
+				_alloc.destroy(&node->value(i));
+				if (internal) {
+					node_pointer	leaf = node->child(i);
+
+					while (!leaf->leaf)
+						leaf = leaf->child(leaf->count);
+					_relocate(&node->value(i), &leaf->value(leaf->count - 1));
+					node = leaf;
+					i = leaf->count - 1;
+				} else
+					for (size_type j = i; j + 1 < node->count; ++j)
+						_relocate(&node->value(j), &node->value(j + 1));
+				node->count--;
+				_size--;
+
+				node_pointer	next = node;
+				size_type		position = i;
+
+				while (node != _root && node->count < _min) {
+					node_pointer	parent = node->parent;
+
+					if (node->position > 0) {
+						node_pointer	left = parent->child(node->position - 1);
+
+						if (static_cast<size_type>(left->count + 1 + node->count) <= slots) {
+							if (next == node) {
+								next = left;
+								position += left->count + 1;
+							}
+							_merge(left, node);
+							node = parent;
+							continue ;
+						}
+						size_type	n = (left->count - node->count) / 2;
+
+						_shiftRight(left, node, n);
+						if (next == node)
+							position += n;
+						break ;
+					}
+					node_pointer	right = parent->child(1);
+
+					if (static_cast<size_type>(node->count + 1 + right->count) <= slots) {
+						_merge(node, right);
+						node = parent;
+						continue ;
+					}
+					_shiftLeft(node, right, (right->count - node->count) / 2);
+					break ;
+				}
+				if (_root->count == 0) {
+					node_pointer	root = _root;
+
+					if (root->leaf) {
+						_deleteNode(root);
+						_root = _leftmost = _rightmost = nullptr;
+						return (end());
+					}
+					_root = root->child(0);
+					_root->parent = nullptr;
+					_root->position = 0;
+					_deleteNode(root);
+				}
+				iterator	result = _normalize(next, position);
+
+				if (internal)
+					++result;
+				return (result);
+			}
+
+			void	_destroy(node_pointer node) {
+				for (size_type i = 0; i < node->count; ++i)
+					_alloc.destroy(&node->value(i));
+				if (!node->leaf)
+					for (size_type i = 0; i <= node->count; ++i)
+						_destroy(node->child(i));
+				_deleteNode(node);
+			}
+
+			/** @brief Copy the subtree rooted at src, node for node */
+			node_pointer	_clone(node_pointer src) {
+				node_pointer	node = _newNode(src->leaf);
+
+				for (size_type i = 0; i < src->count; ++i)
+					_alloc.construct(&node->value(i), src->value(i));
+				node->count = src->count;
+				if (!src->leaf)
+					for (size_type i = 0; i <= src->count; ++i)
+						_setChild(node, i, _clone(src->child(i)));
+				return (node);
+			}
+
+		public:
+			b_tree(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _root(nullptr), _leftmost(nullptr), _rightmost(nullptr), _size(0), _alloc(alloc),
+				  _leaf_allocator(alloc), _internal_allocator(alloc), _compare(comp) {
+				return ;
+			}
+
+			b_tree(const b_tree& x) : _root(nullptr), _leftmost(nullptr), _rightmost(nullptr), _size(0), _alloc(x._alloc),
+				_leaf_allocator(x._leaf_allocator), _internal_allocator(x._internal_allocator), _compare(x._compare) {
+				*this = x;
+				return ;
+			}
+
+			~b_tree() {
+				clear();
+				return ;
+			}
+
+			b_tree&		operator=(const b_tree& x) {
+				if (this == &x)
+					return (*this);
+				clear();
+				_compare = x._compare;
+				if (x._root == nullptr)
+					return (*this);
+				_root = _clone(x._root);
+				for (_leftmost = _root; !_leftmost->leaf; _leftmost = _leftmost->child(0))
+					;
+				for (_rightmost = _root; !_rightmost->leaf; _rightmost = _rightmost->child(_rightmost->count))
+					;
+				_size = x._size;
+				return (*this);
+			}
+
+			size_type	size() const {
+				return (_size);
+			}
+			size_type	max_size() const {
+				return (_alloc.max_size());
+			}
+			allocator_type	get_allocator() const {
+				return (_alloc);
+			}
+			key_compare		key_comp() const {
+				return (_compare);
+			}
+
+			void		clear() {
+				if (_root != nullptr)
+					_destroy(_root);
+				_root = _leftmost = _rightmost = nullptr;
+				_size = 0;
+			}
+
+			iterator		begin() {
+				return (iterator(_leftmost, 0));
+			}
+			const_iterator	begin() const {
+				return (const_iterator(_leftmost, 0));
+			}
+			iterator		end() {
+				return (iterator(_rightmost, _rightmost ? _rightmost->count : 0));
+			}
+			const_iterator	end() const {
+				return (const_iterator(_rightmost, _rightmost ? _rightmost->count : 0));
+			}
+			reverse_iterator		rbegin() {
+				return (reverse_iterator(end()));
+			}
+			const_reverse_iterator	rbegin() const {
+				return (const_reverse_iterator(end()));
+			}
+			reverse_iterator		rend() {
+				return (reverse_iterator(begin()));
+			}
+			const_reverse_iterator	rend() const {
+				return (const_reverse_iterator(begin()));
+			}
+
+			/** @brief Insert value unless it's key is already in the tree
+			 * @return An iterator to the element with the key, and whether it was inserted
+			 */
+			ft::pair<iterator, bool>	insert(const value_type& value) {
+				node_pointer	node;
+				size_type		i;
+
+				if (_root == nullptr)
+					_root = _leftmost = _rightmost = _newNode(true);
+				if (_descend(KeyOfValue()(value), node, i))
+					return (ft::make_pair(iterator(node, i), false));
+				return (ft::make_pair(_insertLeaf(node, i, value), true));
+			}
+
+			/** @brief Insert value, it's key being expected to go right before hint
+			 * When it does, the value goes to the leaf slot right before hint without any search: inserting sorted
+			 * keys with end() as hint takes amortized constant time each and leaves full leaves behind. Otherwise
+			 * falls back to insert(value).
+			 */
+			iterator	insert(iterator hint, const value_type& value) {
+				const key_type&	key = KeyOfValue()(value);
+
+				if (_size != 0 && (hint == end() || _compare(key, KeyOfValue()(*hint)))) {
+					iterator	prev = hint;
+
+					if (hint == begin() || _compare(KeyOfValue()(*--prev), key)) {
+						node_pointer	node = hint.getNode();
+						size_type		i = hint.getPosition();
+
+						if (!node->leaf) {
+							for (node = node->child(i); !node->leaf; node = node->child(node->count))
+								;
+							i = node->count;
+						}
+						return (_insertLeaf(node, i, value));
+					}
+				}
+				return (insert(value).first);
+			}
+
+			/** @brief Append value after the last element
+			 * The key of value must be greater than every key in the tree: the value goes to the last slot of the
+			 * rightmost leaf without comparing any key, full nodes being split so that they stay full.
+			 */
+			iterator	append(const value_type& value) {
+				if (_root == nullptr)
+					_root = _leftmost = _rightmost = _newNode(true);
+				return (_insertLeaf(_rightmost, _rightmost->count, value));
+			}
+
+			/** @brief Insert the values of [first, last), one at a time with end() as hint */
+			template <class InputIterator>
+			void	insert_range(InputIterator first, InputIterator last) {
+				for (; first != last; ++first)
+					insert(end(), *first);
+			}
+
+			/** @brief Insert key with a mapped value built from args, unless key is already in the tree
+			 * The mapped value is constructed right in it's slot (see ft::piecewise_construct).
+			 *
+			 * @return An iterator to the element with the key, and whether it was inserted
+			 */
+			template <class... Args>
+			ft::pair<iterator, bool>	try_emplace(const key_type& key, Args&&... args) {
+				node_pointer	node;
+				size_type		i;
+
+				if (_root == nullptr)
+					_root = _leftmost = _rightmost = _newNode(true);
+				if (_descend(key, node, i))
+					return (ft::make_pair(iterator(node, i), false));
+				return (ft::make_pair(_insertLeaf(node, i, ft::piecewise_construct, key, std::forward<Args>(args)...), true));
+			}
+
+			/** @brief Erase the element at position
+			 * @return An iterator to the element that followed it
+			 */
+			iterator	erase(iterator position) {
+				return (_erase(position.getNode(), position.getPosition()));
+			}
+			size_type	erase(const key_type& key) {
+				node_pointer	node;
+				size_type		i;
+
+				if (_root == nullptr || !_descend(key, node, i))
+					return (0);
+				_erase(node, i);
+				return (1);
+			}
+			iterator	erase(iterator first, iterator last) {
+				size_type	n = 0;
+
+				if (first == begin() && last == end()) {
+					clear();
+					return (end());
+				}
+				for (iterator it = first; it != last; ++it)
+					n++;
+				while (n--)
+					first = erase(first);
+				return (first);
+			}
+
+			void		swap(b_tree& x) {
+				std::swap(_root, x._root);
+				std::swap(_leftmost, x._leftmost);
+				std::swap(_rightmost, x._rightmost);
+				std::swap(_size, x._size);
+				std::swap(_alloc, x._alloc);
+				std::swap(_leaf_allocator, x._leaf_allocator);
+				std::swap(_internal_allocator, x._internal_allocator);
+				std::swap(_compare, x._compare);
+			}
+
+			iterator		find(const key_type& key) {
+				node_pointer	node;
+				size_type		i;
+
+				if (_root == nullptr || !_descend(key, node, i))
+					return (end());
+				return (iterator(node, i));
+			}
+			const_iterator	find(const key_type& key) const {
+				node_pointer	node;
+				size_type		i;
+
+				if (_root == nullptr || !_descend(key, node, i))
+					return (end());
+				return (const_iterator(node, i));
+			}
+
+			/*
+			 * The bounds descend once: the last slot passed on the way down that is not before key (or after it, for
+			 * upper_bound) is the answer when the leaf has none.
+			 */
+			iterator		lower_bound(const key_type& key) {
+				node_pointer	node = _root;
+				iterator		bound = end();
+
+				while (node != nullptr) {
+					size_type	i = _lowerIndex(node, key);
+
+					if (i < node->count) {
+						bound = iterator(node, i);
+						if (!_compare(key, _key(node, i)))
+							break ;
+					}
+					node = node->leaf ? nullptr : node->child(i);
+				}
+				return (bound);
+			}
+			const_iterator	lower_bound(const key_type& key) const {
+				return (const_cast<b_tree*>(this)->lower_bound(key));
+			}
+			iterator		upper_bound(const key_type& key) {
+				node_pointer	node = _root;
+				iterator		bound = end();
+
+				while (node != nullptr) {
+					size_type	i = _upperIndex(node, key);
+
+					if (i < node->count)
+						bound = iterator(node, i);
+					node = node->leaf ? nullptr : node->child(i);
+				}
+				return (bound);
+			}
+			const_iterator	upper_bound(const key_type& key) const {
+				return (const_cast<b_tree*>(this)->upper_bound(key));
+			}
+			/** @brief lower_bound and upper_bound of key, in one descent
+			 * Both searches follow the same path down to the slot holding key, whose next value is then the upper
+			 * bound. Without such a slot both bounds are the same.
+			 */
+			ft::pair<iterator, iterator>	equal_range(const key_type& key) {
+				node_pointer	node = _root;
+				iterator		bound = end();
+
+				while (node != nullptr) {
+					size_type	i = _lowerIndex(node, key);
+
+					if (i < node->count) {
+						bound = iterator(node, i);
+						if (!_compare(key, _key(node, i))) {
+							iterator	next = bound;
+
+							return (ft::make_pair(bound, ++next));
+						}
+					}
+					node = node->leaf ? nullptr : node->child(i);
+				}
+				return (ft::make_pair(bound, bound));
+			}
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type& key) const {
+				ft::pair<iterator, iterator>	range = const_cast<b_tree*>(this)->equal_range(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			}
+	};
+}
+
+#endif
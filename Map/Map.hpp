@@ -20,7 +20,13 @@
 # include "red_black_tree.hpp"
 
 namespace ft {
-	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+	/** @brief Map
+	 * @tparam NodeUpdate Node update policy of the red black tree (see node_update.hpp): with
+	 * ft::rbt_order_statistics_node_update, nth, rank, count_range and distance take logarithmic time, with
+	 * ft::rbt_aggregate_node_update, aggregate does.
+	 */
+	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >,
+		class NodeUpdate = ft::rbt_null_node_update>
 	class Map {
 	public:
 		typedef T			mapped_type;
@@ -37,7 +43,7 @@ namespace ft {
 				return key_compare()(x.first, y.first);
 			}
 		};
-		typedef ft::Node<value_type, allocator_type>						node_type;
+		typedef ft::Node<value_type, allocator_type, NodeUpdate>			node_type;
 		typedef node_type*									node_pointer;
 		typedef typename	allocator_type::pointer			pointer;
 		typedef typename 	allocator_type::reference 		reference;
@@ -45,7 +51,7 @@ namespace ft {
 		typedef typename 	allocator_type::const_reference	const_reference;
 
 		// Red black tree
-		typedef ft::red_black_tree<value_type, Compare, Alloc>								tree_type;
+		typedef ft::red_black_tree<value_type, Compare, Alloc, NodeUpdate>					tree_type;
 		// Iterators
 		typedef ft::rbt_iterator<value_type, node_type, tree_type>					iterator;
 		typedef ft::rbt_iterator<const value_type, node_type, tree_type >			const_iterator;
@@ -67,23 +73,28 @@ namespace ft {
 		template <class InputIterator>
 			Map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
 				 const allocator_type& alloc = allocator_type()): _rbtree(), _compare(comp), _value_compare(value_compare()), _alloc(alloc) {
-					for (InputIterator it = first; it != last ; it++) {
-						_rbtree.insert(*it);
-					}
+					_rbtree.insert_range(first, last);
 			}
 
-		Map (const Map& x) {
-			if (this == &x)
-				return ;
-			_rbtree.clear();
-			_rbtree = x._rbtree;
+		/** @brief Construct from a sorted range
+		 * [first, last) must be sorted by comp without duplicate keys, the tree is then built in linear time
+		 * without comparing any key.
+		 */
+		template <class ForwardIterator>
+			Map (ft::sorted_unique_t, ForwardIterator first, ForwardIterator last, const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type()): _rbtree(), _compare(comp), _value_compare(value_compare()), _alloc(alloc) {
+					_rbtree.assign_sorted(first, last);
+			}
+
+		Map (const Map& x): _rbtree(x._rbtree), _compare(x._compare), _value_compare(x._value_compare), _alloc(x._alloc) {
+			return ;
 		}
 
 		~Map() {
 		}
 
 		Map&	operator=(const Map& x) {
-			if (*this != x) {
+			if (this != &x) {
 				_rbtree = x._rbtree;
 				_alloc = x._alloc;
 				_compare = x._compare;
@@ -133,46 +144,81 @@ namespace ft {
 		}
 
 		mapped_type&	operator[] (const key_type& k) {
-			node_pointer node = _rbtree.find(k);
-			
-			if (node == nullptr) {
-				ft::pair<iterator, bool> it = insert(ft::make_pair(k, mapped_type()));
-				return (it.first->second);
-			}
-			return (node->data->second);
+			return (_rbtree.try_emplace(k).first->data.second);
 		}
 
 		ft::pair<iterator, bool>	insert (const value_type& val) {
-			node_pointer node = _rbtree.find(val.first);
+			ft::pair<node_pointer, bool>	inserted = _rbtree.insert(val);
 
-			if (node != nullptr)
-				return (ft::make_pair(iterator(node, &_rbtree), false));
-			return (ft::make_pair(iterator(_rbtree.insert(val), &_rbtree), true));
+			return (ft::make_pair(iterator(inserted.first), inserted.second));
 		}
 
 		iterator 	insert(iterator position, const value_type& val) {
-			(void) position;
-			return (iterator(_rbtree.insert(val), &_rbtree));
+			return (iterator(_rbtree.insert(position.getNode(), val).first));
+		}
+
+		/** @brief Insert element built in place unless it's key exists
+		 * Inserts a new element with key k and a mapped value constructed from args, when no element has the key k
+		 * yet. Otherwise nothing happens, args are left untouched. The tree is descended once.
+		 *
+		 * @param k The key of the element
+		 * @param args Arguments passed to the constructor of the mapped value
+		 * @return A pair with an iterator to the element with key k, and true if it was inserted
+		 */
+		template <class... Args>
+		ft::pair<iterator, bool>	try_emplace(const key_type& k, Args&&... args) {
+			ft::pair<node_pointer, bool>	inserted = _rbtree.try_emplace(k, std::forward<Args>(args)...);
+
+			return (ft::make_pair(iterator(inserted.first), inserted.second));
+		}
+
+		/** @brief Insert element or assign to it's mapped value
+		 * Inserts a new element (k, obj) when no element has the key k, otherwise assigns obj to the mapped value of
+		 * the existing one. The tree is descended once.
+		 *
+		 * @param k The key of the element
+		 * @param obj The value to insert or assign
+		 * @return A pair with an iterator to the element with key k, and true if it was inserted, false if assigned
+		 */
+		template <class M>
+		ft::pair<iterator, bool>	insert_or_assign(const key_type& k, const M& obj) {
+			ft::pair<node_pointer, bool>	inserted = _rbtree.try_emplace(k, obj);
+
+			if (!inserted.second) {
+				inserted.first->data.second = obj;
+				_rbtree.refresh(inserted.first);
+			}
+			return (ft::make_pair(iterator(inserted.first), inserted.second));
 		}
+
 		template <class InputIterator>
 				void 	insert (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator() ) {
-			for (InputIterator it = first; it != last; it++) {
-				_rbtree.insert(*it);
-			}
+			_rbtree.insert_range(first, last);
 		}
 
 		void 		erase(iterator position) {
-			_rbtree.remove(position->first);
+			_rbtree.erase(position.getNode());
 		}
 		size_type	erase (const key_type& k) {
 			return (_rbtree.remove(k));
 		}
+		/** @brief Erase the elements whose key is equivalent to k, which needs not be a key_type
+		 * Only with a transparent comparator (see ft::is_transparent), and for k neither an iterator nor a
+		 * const_iterator, erasing by position staying erase(iterator).
+		 */
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value && !std::is_convertible<K, iterator>::value
+			&& !std::is_convertible<K, const_iterator>::value, size_type>::type	erase (const K& k) {
+			ft::pair<iterator, iterator>	range = equal_range(k);
+			size_type						n = 0;
+
+			for (iterator it = range.first; it != range.second; ++it)
+				++n;
+			erase(range.first, range.second);
+			return (n);
+		}
 		void 	erase (iterator first, iterator last) {
-			ft::Vector<key_type> keys;
-			for(iterator it = first; it != last; ++it)
-				keys.push_back(it->first);
-			for (typename ft::Vector<key_type>::iterator it = keys.begin(); it != keys.end(); ++it)
-				_rbtree.remove(*it);
+			_rbtree.erase(first.getNode(), last.getNode());
 		}
 
 		void 	swap(Map& x) {
@@ -196,14 +242,14 @@ namespace ft {
 			node_pointer node = _rbtree.find(k);
 			
 			if (node != nullptr)
-				return (iterator(node, &_rbtree));
+				return (iterator(node));
 			return (end());
 		}
 		const_iterator	find(const key_type& k) const {
 			node_pointer node = _rbtree.find(k);
 			
 			if (node != nullptr)
-				return (const_iterator(node, &_rbtree));
+				return (const_iterator(node));
 			return (end());
 		}
 
@@ -213,31 +259,131 @@ namespace ft {
 			return (0);
 		}
 		iterator		lower_bound(const key_type& k) {
-			iterator it = find(k);
-
-			if (it != end())
-				return (it);
-			return (_rbtree.findSuccessor(k));
+			return (iterator(_rbtree.lower_bound(k)));
 		}
 		const_iterator	lower_bound(const key_type& k) const {
-			const_iterator it = find(k);
-
-			if (it != end())
-				return (it);
-			return (_rbtree.findSuccessor(k));
+			return (const_iterator(_rbtree.lower_bound(k)));
 		}
 		iterator		upper_bound(const key_type& k) {
-			return (_rbtree.findSuccessor(k));
+			return (iterator(_rbtree.upper_bound(k)));
 		}
 		const_iterator	upper_bound(const key_type& k) const {
-			return (_rbtree.findSuccessor(k));
+			return (const_iterator(_rbtree.upper_bound(k)));
 		}
 
 		ft::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const {
-			return ft::make_pair(lower_bound(k), upper_bound(k));
+			ft::pair<node_pointer, node_pointer>	range = _rbtree.equal_range(k);
+
+			return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
 		}
 		ft::pair<iterator, iterator>				equal_range(const key_type& k) {
-			return ft::make_pair(lower_bound(k), upper_bound(k));
+			ft::pair<node_pointer, node_pointer>	range = _rbtree.equal_range(k);
+
+			return ft::make_pair(iterator(range.first), iterator(range.second));
+		}
+
+		/*
+		 * Heterogeneous lookups, with a transparent comparator (see ft::is_transparent): k is anything the
+		 * comparator compares with key_type, and is never converted to one. With ft::Map<std::string, T, std::less<> >,
+		 * find("key") builds no std::string. Several keys may be equivalent to such a k: find returns any of them,
+		 * count and equal_range cover them all.
+		 */
+
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type			find(const K& k) {
+			node_pointer node = _rbtree.find(k);
+
+			if (node != nullptr)
+				return (iterator(node));
+			return (end());
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, const_iterator>::type	find(const K& k) const {
+			node_pointer node = _rbtree.find(k);
+
+			if (node != nullptr)
+				return (const_iterator(node));
+			return (end());
+		}
+
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, size_type>::type		count(const K& k) const {
+			ft::pair<const_iterator, const_iterator>	range = equal_range(k);
+			size_type									n = 0;
+
+			for (; range.first != range.second; ++range.first)
+				++n;
+			return (n);
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type			lower_bound(const K& k) {
+			return (iterator(_rbtree.lower_bound(k)));
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, const_iterator>::type	lower_bound(const K& k) const {
+			return (const_iterator(_rbtree.lower_bound(k)));
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type			upper_bound(const K& k) {
+			return (iterator(_rbtree.upper_bound(k)));
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, const_iterator>::type	upper_bound(const K& k) const {
+			return (const_iterator(_rbtree.upper_bound(k)));
+		}
+
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, ft::pair<const_iterator, const_iterator> >::type
+			equal_range(const K& k) const {
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+		template <class K, class C = Compare>
+		typename ft::enable_if<ft::is_transparent<C>::value, ft::pair<iterator, iterator> >::type
+			equal_range(const K& k) {
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+
+		/** @brief Element at index k in key order
+		 * Requires ft::rbt_order_statistics_node_update, as rank, count_range and distance do.
+		 *
+		 * @return An iterator to the element, end() when k is not less than size()
+		 */
+		iterator		nth(size_type k) {
+			return (iterator(_rbtree.select(k)));
+		}
+		const_iterator	nth(size_type k) const {
+			return (const_iterator(_rbtree.select(k)));
+		}
+		/** @brief Number of elements with a key less than k, the index of k when it is in the map */
+		size_type		rank(const key_type& k) const {
+			return (_rbtree.rank(k));
+		}
+		/** @brief Number of elements with a key in [lo, hi) */
+		size_type		count_range(const key_type& lo, const key_type& hi) const {
+			if (!_compare(lo, hi))
+				return (0);
+			return (_rbtree.rank(hi) - _rbtree.rank(lo));
+		}
+		/** @brief Number of increments from first to last, negative when last comes before first */
+		difference_type	distance(const_iterator first, const_iterator last) const {
+			return (static_cast<difference_type>(_rbtree.rank(last.getNode())) - static_cast<difference_type>(_rbtree.rank(first.getNode())));
+		}
+
+		/** @brief Fold the elements with a key in [lo, hi)
+		 * Requires ft::rbt_aggregate_node_update<Monoid>.
+		 *
+		 * @return The combination of the summaries of the elements in key order, Monoid::identity() for none
+		 */
+		template <class Update = NodeUpdate>
+		typename Update::summary_type	aggregate(const key_type& lo, const key_type& hi) const {
+			return (_rbtree.template aggregate<Update>(lo, hi));
+		}
+		/** @brief Update the summaries after the mapped value at position was changed in place
+		 * A mapped value changed through operator[], an iterator or a reference leaves the summaries of the tree
+		 * behind until then; insert_or_assign takes care of it.
+		 */
+		void	refresh(iterator position) {
+			_rbtree.refresh(position.getNode());
 		}
 
 		allocator_type		get_allocator() const {
@@ -270,42 +416,42 @@ namespace ft {
 	// 	}
 	// 	return (first2!=last2);
 	// }
-		template <class Key, class T, class Compare, class Alloc>
-	bool operator== ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ) {
+		template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator== ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ) {
 							if (lhs.size() != rhs.size())
 								return (lhs.size() == rhs.size());
 							return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 						}
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!= ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator!= ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (!(lhs == rhs));
 						}
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<  ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator<  ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 						}
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<= ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator<= ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ) {
 							if (lhs  < rhs || lhs == rhs)
             					return (true);
         					return (false);
 						}
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>  ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ){
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator>  ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ){
 							return (!(lhs <= rhs));
 						}
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>= ( const ft::Map<Key,T,Compare,Alloc>& lhs,
-						const ft::Map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator>= ( const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& lhs,
+						const ft::Map<Key,T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (!(lhs < rhs));
 						}
-	template <class Key, class T, class Compare, class Alloc>
-  	void swap (Map<Key,T,Compare,Alloc>& x, Map<Key,T,Compare,Alloc>& y) {
+	template <class Key, class T, class Compare, class Alloc, class NodeUpdate>
+  	void swap (Map<Key,T,Compare,Alloc,NodeUpdate>& x, Map<Key,T,Compare,Alloc,NodeUpdate>& y) {
 		  x.swap(y);
 		  return ;
 	  }
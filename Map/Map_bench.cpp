@@ -0,0 +1,85 @@
+/* ************************************************************************************************ */
+/*                                                                                                  */
+/*   Map_bench.cpp                                                                                  */
+/*                                                                                                  */
+/*   Compares std::map with ft::Map on a session table load: a table of live keys is filled, then   */
+/*   churned by erasing a random key and inserting a new one, and finally walked in order. ft::Map */
+/*   runs with std::allocator and with ft::PoolAllocator, whose nodes are recycled from slabs.      */
+/*                                                                                                  */
+/*   usage: ./Map_bench [live keys] [churn operations]                                              */
+/*                                                                                                  */
+/* ************************************************************************************************ */
+# include <map>
+# include <iostream>
+# include <iomanip>
+# include <cstdlib>
+# include <stdint.h>
+# include <sys/time.h>
+# include "Map.hpp"
+# include "../utils/pool_allocator.hpp"
+
+# define DEFAULT_KEYS 200000
+# define DEFAULT_OPERATIONS 2000000
+
+double get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    return ((time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3));
+}
+
+uint64_t    next_key(uint64_t& state)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (state >> 24);
+}
+
+template <class Container>
+void    churn_load(const char *name, size_t keys, size_t operations)
+{
+    Container   table;
+    uint64_t    insert_state = 1;
+    uint64_t    erase_state = 1;
+    double      start = get_time();
+
+    for (size_t i = 0; i < keys; ++i)
+        table[next_key(insert_state)] = i;
+    double      filled = get_time();
+    for (size_t i = 0; i < operations; ++i) {
+        table.erase(next_key(erase_state));
+        table[next_key(insert_state)] = i;
+    }
+    double      churned = get_time();
+    uint64_t    checksum = 0;
+
+    for (typename Container::iterator it = table.begin(); it != table.end(); ++it)
+        checksum += it->second;
+    double      walked = get_time();
+
+    std::cout << std::setw(26) << std::left << name
+              << std::setw(12) << std::right << std::fixed << std::setprecision(1) << (filled - start)
+              << std::setw(14) << (churned - filled)
+              << std::setw(14) << std::setprecision(2) << (operations * 2 / ((churned - filled) * 1e3))
+              << std::setw(12) << (walked - churned)
+              << std::setw(12) << checksum % 1000 << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  keys = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : DEFAULT_KEYS;
+    size_t  operations = (argc > 2) ? std::strtoul(argv[2], NULL, 10) : DEFAULT_OPERATIONS;
+
+    std::cout << "\033[1;36m" << keys << " live keys, " << operations << " erase + insert\033[0m\n\n";
+    std::cout << std::setw(26) << std::left << "container"
+              << std::setw(12) << std::right << "fill (ms)"
+              << std::setw(14) << "churn (ms)"
+              << std::setw(14) << "Mops/s"
+              << std::setw(12) << "walk (ms)"
+              << std::setw(12) << "checksum" << std::endl;
+    churn_load<std::map<uint64_t, uint64_t> >("std::map", keys, operations);
+    churn_load<ft::Map<uint64_t, uint64_t> >("ft::Map std::allocator", keys, operations);
+    churn_load<ft::Map<uint64_t, uint64_t, std::less<uint64_t>, ft::PoolAllocator<ft::pair<const uint64_t, uint64_t> > > >
+        ("ft::Map PoolAllocator", keys, operations);
+    return (0);
+}
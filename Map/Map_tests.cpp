@@ -7,10 +7,13 @@
 #include "Map.hpp"       // your Map path.
 //#include "../Vector/Vector.hpp" // your Vector path.path
 #include "../utils/pair.hpp"  // path to ft::pair.
+#include "../utils/mmap_allocator.hpp"
+#include "../utils/pool_allocator.hpp"
 // #include "map-test-helper.hpp"
 #include <map>
 #include "../Vector/reverse_iterator.hpp"
 #include <vector>
+#include <memory>
 #include <iostream>
 #include <iterator>
 #include <utility>
@@ -64,6 +67,61 @@ bool compareMaps(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2)
 
 bool fncomp(char lhs, char rhs) { return lhs < rhs; }
 
+struct SumOfValues
+{
+    typedef long long summary_type;
+    static long long identity() { return 0; }
+    static long long summarize(const ft::pair<const int, int> &x) { return x.second; }
+    static long long combine(long long lhs, long long rhs) { return lhs + rhs; }
+};
+
+struct MaxOfValues
+{
+    typedef int summary_type;
+    static int identity() { return -1; }
+    static int summarize(const ft::pair<const int, int> &x) { return x.second; }
+    static int combine(int lhs, int rhs) { return std::max(lhs, rhs); }
+};
+
+/*
+ * A summary owning heap memory, counting it's live instances
+ */
+struct Tracked
+{
+    static long live;
+    std::string s;
+
+    Tracked() { ++live; }
+    Tracked(const std::string &str) : s(str) { ++live; }
+    Tracked(const Tracked &x) : s(x.s) { ++live; }
+    ~Tracked() { --live; }
+    Tracked &operator=(const Tracked &x) { s = x.s; return (*this); }
+};
+long Tracked::live = 0;
+
+struct ConcatOfValues
+{
+    typedef Tracked summary_type;
+    static Tracked identity() { return Tracked(); }
+    static Tracked summarize(const ft::pair<const int, std::string> &x) { return Tracked(x.second); }
+    static Tracked combine(const Tracked &lhs, const Tracked &rhs) { return Tracked(lhs.s + rhs.s); }
+};
+
+/*
+ * A value that can be neither copied nor moved
+ */
+struct Pinned
+{
+    int n;
+
+    Pinned() : n(0) {}
+    Pinned(int x, int y) : n(x * y) {}
+
+private:
+    Pinned(const Pinned &);
+    Pinned &operator=(const Pinned &);
+};
+
 struct classcomp
 {
     bool operator()(const char &lhs, const char &rhs) const
@@ -72,6 +130,21 @@ struct classcomp
     }
 };
 
+struct Initial
+{
+    char c;
+};
+
+struct NameLess
+{
+    typedef void is_transparent;
+    bool operator()(const std::string &lhs, const std::string &rhs) const { return lhs < rhs; }
+    bool operator()(const std::string &lhs, const char *rhs) const { return lhs.compare(rhs) < 0; }
+    bool operator()(const char *lhs, const std::string &rhs) const { return rhs.compare(lhs) > 0; }
+    bool operator()(const std::string &lhs, Initial rhs) const { return lhs[0] < rhs.c; }
+    bool operator()(Initial lhs, const std::string &rhs) const { return lhs.c < rhs[0]; }
+};
+
 bool testMapConstructors()
 {
     bool cond;
@@ -535,6 +608,45 @@ void testConstructors()
         }
         EQUAL(res == my_res && my_res == my_res1);
     }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " sorted range constructor "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond = true;
+
+        for (int n = 0; n < 300; n += 7) {
+            ft::Vector<ft::pair<int, std::string> > v;
+            std::map<int, std::string> m;
+
+            for (int i = 0; i < n; ++i) {
+                v.push_back(ft::make_pair(i * 3, std::string(i % 10, 'x')));
+                m[i * 3] = std::string(i % 10, 'x');
+            }
+            ft::Map<int, std::string> sorted(ft::sorted_unique, v.begin(), v.end());
+            ft::Map<int, std::string> detected(v.begin(), v.end());
+            ft::Map<int, std::string> from_map(detected.begin(), detected.end());
+
+            // the built trees must keep working as usual
+            sorted.erase(3);
+            sorted[3] = "back";
+            sorted[n * 3 + 1] = "last";
+            m[3] = "back";
+            m[n * 3 + 1] = "last";
+            from_map.insert(v.begin(), v.end());
+            cond = cond && sorted.size() == m.size() && compareMaps(sorted.begin(), sorted.end(), m.begin(), m.end())
+                && detected.size() == static_cast<size_t>(n) && from_map.size() == static_cast<size_t>(n)
+                && compareMaps(from_map.begin(), from_map.end(), detected.begin(), detected.end());
+        }
+        // unsorted input and duplicate keys are inserted one by one
+        ft::Vector<ft::pair<int, int> > u;
+        std::map<int, int> m;
+        for (int i = 0; i < 1000; ++i) {
+            u.push_back(ft::make_pair((i * 7919) % 500, i));
+            m.insert(std::make_pair((i * 7919) % 500, i));
+        }
+        ft::Map<int, int> unsorted(u.begin(), u.end());
+        cond = cond && unsorted.size() == m.size() && compareMaps(unsorted.begin(), unsorted.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
     std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy constructor "
               << "] --------------------]\t\t\033[0m";
     {
@@ -1295,6 +1407,182 @@ void testModifiers()
         EQUAL(cond);
     }
 
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert with hint "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::Map<int, int> ft_m;
+
+        // sorted keys after end(), reverse sorted keys before begin(), then hints right and wrong
+        for (int i = 0; i < 5000; ++i) {
+            m.insert(m.end(), std::make_pair(i * 2, i));
+            ft_m.insert(ft_m.end(), ft::make_pair(i * 2, i));
+        }
+        for (int i = -1; i > -5000; --i) {
+            m.insert(m.begin(), std::make_pair(i, i));
+            ft_m.insert(ft_m.begin(), ft::make_pair(i, i));
+        }
+        bool cond = compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        for (int i = 0; i < 5000; ++i) {
+            int key = (i * 7919) % 10001;
+            ft::Map<int, int>::iterator hint = ft_m.lower_bound(key + (i % 3) * 100);
+            ft::Map<int, int>::iterator ft_it = ft_m.insert(hint, ft::make_pair(key, -i));
+            std::map<int, int>::iterator it = m.insert(m.lower_bound(key + (i % 3) * 100), std::make_pair(key, -i));
+
+            cond = cond && ft_it->first == it->first && ft_it->second == it->second;
+        }
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " begin, end and their neighbours "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::Map<int, int> ft_m;
+        bool cond = ft_m.begin() == ft_m.end() && ft_m.rbegin() == ft_m.rend();
+
+        // the extremes move as keys come and go, --end() and rbegin() follow them
+        for (int i = 0; i < 2000; ++i) {
+            int key = (i * 7919) % 1500;
+
+            if (i % 3 == 2 && m.size() > 2) {
+                m.erase(m.begin()->first);
+                ft_m.erase(ft_m.begin());
+                m.erase(m.rbegin()->first);
+                ft_m.erase(--ft_m.end());
+            } else {
+                m[key] = i;
+                ft_m[key] = i;
+            }
+            cond = cond && ft_m.begin()->first == m.begin()->first && (--ft_m.end())->first == (--m.end())->first
+                && ft_m.rbegin()->first == m.rbegin()->first && (--ft_m.rend())->first == (--m.rend())->first;
+        }
+        ft_m.clear();
+        cond = cond && ft_m.begin() == ft_m.end();
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase keeps other iterators valid "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, std::string> m;
+        ft::Map<int, std::string> ft_m;
+        ft::Vector<ft::Map<int, std::string>::iterator> its;
+        bool cond = true;
+
+        for (int i = 0; i < 3000; ++i) {
+            m[i] = std::string(i % 50, 'a' + i % 26);
+            its.push_back(ft_m.insert(ft::make_pair(i, m[i])).first);
+        }
+        // erase every other key, inner nodes included, through an iterator or by key
+        for (int i = 0; i < 3000; i += 2) {
+            m.erase(i);
+            if (i % 4)
+                ft_m.erase(its[i]);
+            else
+                ft_m.erase(i);
+        }
+        for (int i = 1; i < 3000; i += 2)
+            cond = cond && its[i]->first == i && its[i]->second == m[i];
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase a large range "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::Map<int, int> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 10000; ++i) {
+            m.insert(m.end(), std::make_pair(i, i));
+            ft_m.insert(ft_m.end(), ft::make_pair(i, i));
+        }
+        ft::Map<int, int>::iterator kept = ft_m.find(9000);
+        // most of the map at once, then a window sliding over what is left
+        m.erase(m.begin(), m.lower_bound(7000));
+        ft_m.erase(ft_m.begin(), ft_m.lower_bound(7000));
+        cond = cond && kept->first == 9000 && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        for (int i = 10000; i < 12000; i += 100) {
+            for (int j = i; j < i + 100; ++j) {
+                m.insert(m.end(), std::make_pair(j, j));
+                ft_m.insert(ft_m.end(), ft::make_pair(j, j));
+            }
+            m.erase(m.begin(), m.lower_bound(i - 2500));
+            ft_m.erase(ft_m.begin(), ft_m.lower_bound(i - 2500));
+            cond = cond && ft_m.size() == m.size();
+        }
+        m.erase(m.find(11000), m.end());
+        ft_m.erase(ft_m.find(11000), ft_m.end());
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        ft_m.erase(ft_m.begin(), ft_m.end());
+        cond = cond && ft_m.empty() && ft_m.begin() == ft_m.end();
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " try_emplace and insert_or_assign "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond;
+        std::map<int, std::string> m;
+        ft::Map<int, std::string> ft_m;
+        std::string value("forty two");
+
+        // try_emplace builds the mapped value only for a new key, and leaves the arguments alone otherwise
+        ft::pair<ft::Map<int, std::string>::iterator, bool> ret = ft_m.try_emplace(42, 3, 'x');
+        m[42] = "xxx";
+        cond = ret.second && ret.first->first == 42 && ret.first->second == "xxx";
+        ret = ft_m.try_emplace(42, value);
+        cond = cond && !ret.second && ret.first->second == "xxx" && value == "forty two";
+        for (int i = 0; i < 1000; ++i) {
+            ft_m.try_emplace((i * 7919) % 500, i % 20, 'y');
+            m.insert(std::make_pair((i * 7919) % 500, std::string(i % 20, 'y')));
+        }
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+
+        // insert_or_assign overwrites the mapped value of an existing key
+        ret = ft_m.insert_or_assign(42, value);
+        cond = cond && !ret.second && ret.first->second == "forty two";
+        ret = ft_m.insert_or_assign(1000, value);
+        cond = cond && ret.second && ft_m[1000] == "forty two" && ft_m.size() == m.size() + 1;
+        for (int i = 0; i < 500; i += 3) {
+            ft_m.insert_or_assign(i, std::string("assigned"));
+            m[i] = "assigned";
+        }
+        m[1000] = "forty two";
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " try_emplace of non-copyable values "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond;
+        ft::Map<int, Pinned> ft_m;
+
+        // the mapped value is built right in it's node, it never needs to be copied
+        cond = ft_m.try_emplace(6, 6, 7).second && ft_m.try_emplace(6, 1, 1).second == false;
+        for (int i = 0; i < 100; ++i)
+            ft_m.try_emplace(i, i, 2);
+        cond = cond && ft_m.size() == 100 && ft_m[6].n == 42 && ft_m[99].n == 198 && ft_m[100].n == 0;
+        ft_m.erase(ft_m.begin(), ft_m.find(50));
+        cond = cond && ft_m.size() == 51 && ft_m.begin()->second.n == 100;
+
+        // nor a move-only one
+        ft::Map<int, std::unique_ptr<int> > ft_u;
+        int sum = 0;
+
+        for (int i = 100; i > 0; --i)
+            ft_u.try_emplace(i, new int(i));
+        ft_u.erase(ft_u.find(1), ft_u.find(51));
+        for (ft::Map<int, std::unique_ptr<int> >::iterator it = ft_u.begin(); it != ft_u.end(); ++it)
+            sum += *it->second;
+        cond = cond && ft_u.size() == 50 && sum == 3775 && ft_u[60] && !ft_u[101];
+        EQUAL(cond);
+    }
+
     std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase method "
               << "] --------------------]\t\t\033[0m";
 
@@ -2045,6 +2333,126 @@ void testOperations()
         cond = (cond && (ft_c_res.first->first == c_res.first->first) && (ft_c_res.second->first == c_res.second->first));
         EQUAL(cond);
     }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " nth, rank, count_range, distance "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::Map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::rbt_order_statistics_node_update> ft_m;
+        bool cond = true;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            m[(i * 7919) % 10007] = i;
+            ft_m[(i * 7919) % 10007] = i;
+        }
+        for (int i = 0; i < 5000; i += 3)
+        {
+            m.erase((i * 7919) % 10007);
+            ft_m.erase((i * 7919) % 10007);
+        }
+        m.erase(m.lower_bound(2000), m.lower_bound(8000));
+        ft_m.erase(ft_m.lower_bound(2000), ft_m.lower_bound(8000));
+        size_t index = 0;
+        for (std::map<int, int>::iterator it = m.begin(); it != m.end(); ++it, ++index)
+            cond = cond && ft_m.nth(index)->first == it->first && ft_m.rank(it->first) == index;
+        cond = cond && ft_m.nth(m.size()) == ft_m.end() && ft_m.distance(ft_m.begin(), ft_m.end()) == (long)m.size();
+        for (int lo = -10; lo < 10020; lo += 97)
+        {
+            int hi = lo + (lo * 31) % 3000;
+
+            cond = cond && ft_m.count_range(lo, hi) == (size_t)std::distance(m.lower_bound(lo), m.lower_bound(hi));
+            cond = cond && ft_m.rank(lo) == (size_t)std::distance(m.begin(), m.lower_bound(lo));
+            cond = cond && ft_m.distance(ft_m.upper_bound(hi), ft_m.lower_bound(lo)) == -std::distance(m.lower_bound(lo), m.upper_bound(hi));
+        }
+        cond = cond && ft_m.count_range(100, 10) == 0;
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " aggregate "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<int, int> m;
+        ft::Map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::rbt_aggregate_node_update<SumOfValues> > ft_m;
+        ft::Map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::rbt_aggregate_node_update<MaxOfValues> > ft_max;
+        bool cond = true;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            m[(i * 7919) % 10007] = i;
+            ft_m.insert(ft::make_pair((i * 7919) % 10007, i));
+            ft_max.insert(ft::make_pair((i * 7919) % 10007, i));
+        }
+        for (int i = 0; i < 5000; i += 3)
+        {
+            m.erase((i * 7919) % 10007);
+            ft_m.erase((i * 7919) % 10007);
+            ft_max.erase((i * 7919) % 10007);
+        }
+        for (int i = 0; i < 1000; i += 7)
+        {
+            m[i] = i * 3;
+            ft_m.insert_or_assign(i, i * 3);
+            ft_max[i] = i * 3;
+            ft_max.refresh(ft_max.find(i));
+        }
+        for (int lo = -10; lo < 10020; lo += 97)
+        {
+            int hi = lo + (lo * 31) % 3000;
+            long long sum = 0;
+            int max = -1;
+
+            for (std::map<int, int>::iterator it = m.lower_bound(lo); lo < hi && it != m.lower_bound(hi); ++it)
+            {
+                sum += it->second;
+                max = std::max(max, it->second);
+            }
+            cond = cond && ft_m.aggregate(lo, hi) == sum && ft_max.aggregate(lo, hi) == max;
+        }
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " transparent comparator "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<std::string, int> m;
+        ft::Map<std::string, int, NameLess> ft_m;
+        const ft::Map<std::string, int, NameLess> &c_ft_m = ft_m;
+        char buf[16];
+        bool cond = true;
+
+        for (int i = 0; i < 3000; i++)
+        {
+            snprintf(buf, sizeof(buf), "%c%d", 'a' + (i * 7) % 26, (i * 31) % 997);
+            m.insert(std::make_pair(std::string(buf), i));
+            ft_m.insert(ft::make_pair(std::string(buf), i));
+        }
+        for (int i = 0; i < 4000; i++)
+        {
+            snprintf(buf, sizeof(buf), "%c%d", 'a' + (i * 5) % 27, (i * 13) % 1100);
+            const char *k = buf;
+            std::map<std::string, int>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+
+            cond = cond && (ft_m.find(k) == ft_m.end()) == (m.find(k) == m.end()) && ft_m.count(k) == m.count(k);
+            cond = cond && (ft_m.lower_bound(k) == ft_m.end() ? lb == m.end() : lb != m.end() && ft_m.lower_bound(k)->first == lb->first);
+            cond = cond && (c_ft_m.upper_bound(k) == c_ft_m.end() ? ub == m.end() : ub != m.end() && c_ft_m.upper_bound(k)->first == ub->first);
+            cond = cond && ft_m.equal_range(k).first == ft_m.lower_bound(k) && ft_m.equal_range(k).second == ft_m.upper_bound(k);
+        }
+        for (char c = 'a'; c <= 'z'; c += 3)
+        {
+            Initial initial = {c};
+            size_t n = 0;
+
+            for (std::map<std::string, int>::iterator it = m.begin(); it != m.end();)
+                if (it->first[0] == c && ++n)
+                    m.erase(it++);
+                else
+                    ++it;
+            cond = cond && ft_m.count(initial) == n && ft_m.erase(initial) == n && ft_m.count(initial) == 0;
+        }
+        cond = cond && ft_m.size() == m.size() && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
 }
 
 void testAllocatorMethodes()
@@ -2063,6 +2471,83 @@ void testAllocatorMethodes()
         EQUAL(psize == 40);
         mymap.get_allocator().deallocate(p, 5);
     }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " mmap allocator "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::Map<int, std::string, std::less<int>, ft::MmapAllocator<ft::pair<const int, std::string> > > mymap;
+        std::map<int, std::string> m;
+        bool cond = true;
+
+        for (int i = 0; i < 1000; ++i) {
+            mymap[(i * 7919) % 1000] = std::string(i % 50, 'x');
+            m[(i * 7919) % 1000] = std::string(i % 50, 'x');
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            mymap.erase(i);
+            m.erase(i);
+        }
+        cond = (mymap.size() == m.size());
+        std::map<int, std::string>::iterator it = m.begin();
+        for (ft::Map<int, std::string, std::less<int>, ft::MmapAllocator<ft::pair<const int, std::string> > >::iterator
+                 ft_it = mymap.begin(); cond && ft_it != mymap.end(); ++ft_it, ++it)
+            cond = (ft_it->first == it->first && ft_it->second == it->second);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " pool allocator "
+              << "] --------------------]\t\t\033[0m";
+    {
+        typedef ft::Map<int, std::string, std::less<int>, ft::PoolAllocator<ft::pair<const int, std::string> > > pool_map;
+        pool_map mymap;
+        std::map<int, std::string> m;
+        bool cond = true;
+
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 2000; ++i) {
+                mymap[(i * 7919) % 2000] = std::string(i % 50, 'x');
+                m[(i * 7919) % 2000] = std::string(i % 50, 'x');
+            }
+            for (int i = round; i < 2000; i += 2) {
+                mymap.erase(i);
+                m.erase(i);
+            }
+        }
+        pool_map copy(mymap);
+        pool_map other;
+
+        other[-1] = "swapped";
+        other.swap(copy);
+        cond = (mymap.size() == m.size() && other.size() == m.size() && copy.size() == 1 && copy[-1] == "swapped");
+        std::map<int, std::string>::iterator it = m.begin();
+        for (pool_map::iterator ft_it = other.begin(); cond && ft_it != other.end(); ++ft_it, ++it)
+            cond = (ft_it->first == it->first && ft_it->second == it->second);
+        mymap.clear();
+        for (int i = 0; i < 100; ++i)
+            mymap[i] = "reused";
+        cond = cond && mymap.size() == 100 && mymap[42] == "reused";
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " pool allocator with node metadata "
+              << "] --------------------]\t\t\033[0m";
+    {
+        typedef ft::Map<int, std::string, std::less<int>, ft::PoolAllocator<ft::pair<const int, std::string> >,
+            ft::rbt_aggregate_node_update<ConcatOfValues> > pool_map;
+        bool cond = true;
+
+        {
+            pool_map mymap;
+            long empty = Tracked::live; // the header's summary
+
+            for (int i = 0; i < 10; ++i)
+                mymap.insert(ft::make_pair(9 - i, std::string(20, 'a' + 9 - i)));
+            cond = cond && mymap.aggregate(2, 4).s == std::string(20, 'c') + std::string(20, 'd');
+            mymap.clear();
+            cond = cond && Tracked::live == empty;
+            for (int i = 0; i < 10; ++i)
+                mymap.insert(ft::make_pair(i, std::string(20, 'x')));
+        }
+        cond = cond && Tracked::live == 0;
+        EQUAL(cond);
+    }
 }
 void testRetionalOperators()
 {
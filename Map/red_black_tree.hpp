@@ -15,14 +15,23 @@
 #define RED_BLACK_TREE_HPP
 
 # include <iostream>
+# include <utility>
 # include "../Vector/iterator_traits.hpp"
+# include "../utils/utils.hpp"
+# include "../utils/pair.hpp"
+# include "../utils/node_update.hpp"
 
 
 namespace ft {
-	enum Color	{RED=1, BLACK=0, DBLACK=2};
-	template <class Pair, class Alloc>
-	struct Node {
-		typedef	Pair			value_type;
+	enum Color	{RED=1, BLACK=0, HEADER=2};
+	/** @brief Red black tree node
+	 * The value is stored in the node itself, so an element costs a single allocation and it's key sits right
+	 * after the links and the color, on the cache line the search loads anyway. The metadata of the tree's node
+	 * update policy, if any, comes first (see node_update.hpp).
+	 */
+	template <class Pair, class Alloc, class NodeUpdate = ft::rbt_null_node_update>
+	struct Node : NodeUpdate::metadata_type {
+		typedef	Pair				value_type;
 		typedef value_type*		pointer;
 		typedef value_type&		reference;
 		typedef Alloc			allocator_type;
@@ -33,44 +42,29 @@ namespace ft {
 		node_pointer	left;
 		node_pointer	right;
 		node_pointer	parent;
-		pointer			data;
 		Color			color;
+		union {
+			value_type	data;
+		};
 
-		pointer	create_pair(const value_type& data) {
-			pointer	pair_node = allocator_type().allocate(1);
-
-			allocator_type().construct(pair_node, data);
-			return (pair_node);
-		}
-		node_pointer			destroy() {
-			if (!data) {
-				allocator_type().destroy(data);
-				allocator_type().deallocate(data, 1);
-			}
-			return (nullptr);
-		}
-		Node() : left(nullptr), right(nullptr), parent(nullptr), data(nullptr), color(RED) {
+		/** @brief Header node of an empty tree
+		 * Links to itself and holds no value (see red_black_tree).
+		 */
+		Node() : NodeUpdate::metadata_type(), left(this), right(this), parent(nullptr), color(HEADER) {
 			return ;
 		}
-		explicit Node(const value_type& data) : left(nullptr), right(nullptr), parent(nullptr), data(create_pair(data)), color(RED) {
+		explicit Node(const value_type& data) : NodeUpdate::metadata_type(), left(nullptr), right(nullptr), parent(nullptr), color(RED), data(data) {
 			return ;
 		}
-		explicit Node(const Node *node) {
-			if (!node || node == this)
-				return ;
-			left = node->left;
-			right = node->right;
-			parent = node->parent;
-			data = allocator_type().allocate(1);
-			allocator_type().construct(data, *(node->data));
+		/** @brief Node holding key, with a mapped value built in place from args (see ft::piecewise_construct) */
+		template <class Key, class... Args>
+		Node(ft::piecewise_construct_t, const Key& key, Args&&... args) : NodeUpdate::metadata_type(), left(nullptr), right(nullptr),
+			parent(nullptr), color(RED), data(ft::piecewise_construct, key, std::forward<Args>(args)...) {
 			return ;
 		}
 		~Node() {
-			if (left)
-				left = left->destroy();
-			if (right)
-				right = right->destroy();
-			destroy();
+			if (color != HEADER)
+				data.~value_type();
 		}
 		bool	isLeft() {
 			if (parent && parent->left)
@@ -96,6 +90,7 @@ namespace ft {
 			return NULL;
 		}
 	};
+
 	template <class Pair, class node,  class Tree>
 	class rbt_iterator {
 		public:
@@ -111,71 +106,53 @@ namespace ft {
 
 		private:
 			node_pointer	_ptr;
-			tree_type const	*_rbtree;
 
 		public:
-			rbt_iterator(): _ptr(nullptr), _rbtree(nullptr){
+			rbt_iterator(): _ptr(nullptr) {
 				return ;
 			}
 
-			rbt_iterator(node_pointer dnode, tree_type const *rbtree) : _ptr(dnode), _rbtree(rbtree) {
+			explicit rbt_iterator(node_pointer dnode) : _ptr(dnode) {
 				return ;
 			}
 
-			rbt_iterator(const rbt_iterator& x) : _ptr(x._ptr), _rbtree(x._rbtree) {
+			rbt_iterator(const rbt_iterator& x) : _ptr(x._ptr) {
 				return ;
 			}
 
 			rbt_iterator&	operator=(const rbt_iterator& x) {
-				if (*this != x) {
-					_ptr = x._ptr;
-					_rbtree = x._rbtree;
-				}
+				_ptr = x._ptr;
 				return (*this);
 			}
 
 			reference 	operator*() const {
-					if (_ptr == nullptr)
-						return ((reference)*_ptr);
-					return (*(_ptr->data));
+				return (_ptr->data);
 			}
 			pointer	operator->() const {
 				return (&(operator*()));
 			}
+			node_pointer	getNode() const {
+				return (_ptr);
+			}
 			rbt_iterator	operator++() {
-				if (_rbtree == nullptr)
-					return (*this);
-				if (_ptr == nullptr && _rbtree)
-					_ptr = _rbtree->min(_rbtree->getRoot());
-				else
-					_ptr = _rbtree->inorderSuccessor(_ptr);
+				_ptr = tree_type::inorderSuccessor(_ptr);
 				return (*this);
 			}
 
 			rbt_iterator	operator++(int) {
 				rbt_iterator tmp = *this;
 
-				if (_rbtree == nullptr)
-					return (*this);
 				++(*this);
 				return (tmp);
 			}
 
 			rbt_iterator	operator--() {
-				if (_rbtree == nullptr)
-					return (*this);
-
-				if (_ptr == nullptr)
-					_ptr = _rbtree->max(_rbtree->getRoot());
-				else
-					_ptr = _rbtree->inorderPredecessor(_ptr);
+				_ptr = tree_type::inorderPredecessor(_ptr);
 				return (*this);
 			}
 			rbt_iterator	operator--(int) {
 				rbt_iterator tmp = *this;
 
-				if (_rbtree == nullptr)
-					return (*this);
 				--(*this);
 				return (tmp);
 			}
@@ -188,7 +165,7 @@ namespace ft {
 			}
 
 			operator		rbt_iterator<const value_type, node_type, tree_type> () const {
-				return (rbt_iterator<const value_type, node_type, tree_type>(_ptr, _rbtree));
+				return (rbt_iterator<const value_type, node_type, tree_type>(_ptr));
 			}
 	};
 	template <class Iterator> class rbt_reverse_iterator {
@@ -270,16 +247,20 @@ namespace ft {
 			iterator_type	_ptr;
 	};
 
-	template <class Pair, class Compare, typename Alloc>
+	/** @brief Red black tree
+	 * @tparam NodeUpdate Node update policy, keeping a summary of every subtree (see node_update.hpp)
+	 */
+	template <class Pair, class Compare, typename Alloc, class NodeUpdate = ft::rbt_null_node_update>
 	class red_black_tree {
 		public:
 			typedef typename Pair::first_type		key_type;
 			typedef Pair							value_type;
 			typedef Compare							key_compare;
-			typedef ft::Node<value_type, Alloc>		node_type;
+			typedef ft::Node<value_type, Alloc, NodeUpdate>	node_type;
 			typedef node_type*						node_pointer;
 			typedef Alloc							allocator_type;
 			typedef size_t 							size_type;
+			typedef NodeUpdate						node_update;
 
 			typedef typename allocator_type::template rebind<node_type>::other	node_allocator;
 			typedef ft::rbt_iterator<value_type, node_type, red_black_tree>		iterator;
@@ -292,8 +273,20 @@ namespace ft {
 				_node_allocator.construct(node, pair);
 				return (node);
 			}
+			/** @brief Allocate a node holding key, it's mapped value being constructed in place from args */
+			template <class... Args>
+			node_pointer	create_node(ft::piecewise_construct_t, const key_type& key, Args&&... args) {
+				node_pointer node = _node_allocator.allocate(1);
+				_node_allocator.construct(node, ft::piecewise_construct, key, std::forward<Args>(args)...);
+				return (node);
+			}
 		private:
-			node_pointer	_root;
+			/*
+			 * The header sits before the root and after the last node: it's parent is the root, it's left and right
+			 * links the leftmost and rightmost nodes, and the root's parent is the header. end() points to it, so
+			 * begin(), --end() and ++ / -- on any iterator need nothing but the nodes.
+			 */
+			node_type		_header;
 			size_type		_size;
 			node_allocator	_node_allocator;
 			key_compare 	_compare;
@@ -301,75 +294,178 @@ namespace ft {
 
 			void	_destroyNode(node_pointer node)
 			{
-				allocator_type().destroy(node->data);
-				allocator_type().deallocate(node->data, 1);
 				_node_allocator.destroy(node);
 				_node_allocator.deallocate(node, 1);
 			}
-			void	_deleteChild(node_pointer node)
+
+			/** @brief Release every node of the subtree rooted at node
+			 * Walks down to a leaf, frees it and climbs back to it's parent, so no stack is needed whatever the
+			 * depth of the subtree. Without deallocate the nodes are only destroyed, their storage being given
+			 * back by the caller.
+			 */
+			void	_destroyTree(node_pointer node, bool deallocate = true)
 			{
-				node_pointer parent = node->parent;
-				if(!parent)
-				{
-					_destroyNode(node);
-					return ;
-				}
-				if(node == parent->left)
-				{
-					_destroyNode(node);
-					parent->left = NULL;
+				node_pointer	top = (node != nullptr) ? node->parent : nullptr;
+
+				while (node != top) {
+					if (node->left != nullptr)
+						node = node->left;
+					else if (node->right != nullptr)
+						node = node->right;
+					else {
+						node_pointer	parent = node->parent;
+
+						if (parent != top && parent->left == node)
+							parent->left = nullptr;
+						else if (parent != top)
+							parent->right = nullptr;
+						if (deallocate)
+							_destroyNode(node);
+						else
+							_node_allocator.destroy(node);
+						node = parent;
+					}
 				}
+			}
+			void	_release(node_pointer root, false_type)
+			{
+				_destroyTree(root);
+			}
+
+			/** @brief Release every node at once
+			 * The node allocator gives all of it's storage back in one call (see ft::PoolAllocator): only the
+			 * nodes need a walk to be destroyed, value and node update metadata alike, and none at all when
+			 * neither has a destructor that does anything.
+			 */
+			void	_release(node_pointer root, true_type)
+			{
+				if (!(is_trivially_destructible<value_type>::value
+					&& is_trivially_destructible<typename node_update::metadata_type>::value))
+					_destroyTree(root, false);
+				_node_allocator.release();
+			}
+			/** @brief Update the metadata of node and of all it's ancestors, bottom up
+			 */
+			void	_updatePath(node_pointer node) {
+				if (!node_update::enabled)
+					return ;
+				for (; node != nullptr && node != &_header; node = node->parent)
+					node_update::update(node);
+			}
+			/** @brief Put child (possibly nullptr) in node's place under node's parent
+			 */
+			void	_transplant(node_pointer node, node_pointer child)
+			{
+				if (node == _header.parent)
+					_header.parent = child;
+				else if (node == node->parent->left)
+					node->parent->left = child;
 				else
-				{
-					_destroyNode(node);
-					parent->right = NULL;
-				}
+					node->parent->right = child;
+				if (child != nullptr)
+					child->parent = node->parent;
 			}
-			node_type*		_insert(node_pointer &root, node_pointer &node) {
-				if (root == nullptr)
-					return (node);
-				if (_compare(node->data->first, root->data->first)) {
-					root->left = _insert(root->left, node);
-					root->left->parent = root;
-				} else if (_compare(root->data->first, node->data->first)){
-					root->right = _insert(root->right, node);
-					root->right->parent = root;
+
+			/** @brief Exchange the places of node and it's in-order successor next, colors included
+			 * next is the leftmost node of node's right subtree and has no left child, so once moved node has at
+			 * most a right child. Only links change: both values stay in their nodes.
+			 */
+			void	_swapWithSuccessor(node_pointer node, node_pointer next)
+			{
+				node_pointer	next_parent = next->parent;
+				node_pointer	next_right = next->right;
+
+				_transplant(node, next);
+				next->left = node->left;
+				next->left->parent = next;
+				if (next_parent == node) {
+					next->right = node;
+					node->parent = next;
+				} else {
+					next->right = node->right;
+					next->right->parent = next;
+					next_parent->left = node;
+					node->parent = next_parent;
 				}
-				return (root);
+				node->left = nullptr;
+				node->right = next_right;
+				if (next_right != nullptr)
+					next_right->parent = node;
+				std::swap(node->color, next->color);
+			}
+			/** @brief Find key, or the empty link it belongs to
+			 * A single descent: returns the node holding key when there is one, otherwise nullptr with parent and
+			 * link set to where a node for key has to be attached (see _attach).
+			 */
+			node_pointer	_descend(const key_type& key, node_pointer& parent, node_pointer*& link) {
+				parent = &_header;
+				link = &_header.parent;
+				while (*link != nullptr) {
+					parent = *link;
+					if (_compare(key, parent->data.first))
+						link = &parent->left;
+					else if (_compare(parent->data.first, key))
+						link = &parent->right;
+					else
+						return (parent);
+				}
+				return (nullptr);
 			}
-			void 			_remove(node_type *&root, node_type *&node) {
-				if (node == nullptr)
-					return ;
-				if (root && !_compare(root->data->first, node->data->first) && !_compare(node->data->first, root->data->first)) {
-					if (!(node->left) && !(node->right)) { // if node has no children then simply delete it
-						if (node == _root) {
-							_destroyNode(node);
-							_root = nullptr;
-							return ;
-						}
-						_removeFix(node);
-						_deleteChild(node);
-						node = nullptr;
-					} else { // if not get either it's predecessor or successor
-						if (node->left) {
-							node_pointer pre = inorderPredecessor(node);
-							allocator_type().destroy(node->data);
-							allocator_type().construct(node->data, *(pre->data));
-							_remove(node, pre);
-						} else if (node->right) {
-							node_pointer suc = inorderSuccessor(node);
-							allocator_type().destroy(node->data);
-							allocator_type().construct(node->data, *(suc->data));
-							_remove(node, suc);
-						}
-					}
-					return ;
+
+			/** @brief Attach node at the link found by _descend and rebalance
+			 * @return node
+			 */
+			node_pointer	_attach(node_pointer node, node_pointer parent, node_pointer* link) {
+				node->parent = parent;
+				*link = node;
+				if (parent == &_header)
+					_header.left = _header.right = node;
+				else if (parent == _header.left && link == &parent->left)
+					_header.left = node;
+				else if (parent == _header.right && link == &parent->right)
+					_header.right = node;
+				_size++;
+				_updatePath(node);
+				_insertFix(node);
+				return (node);
+			}
+
+			/** @brief Unlink node from the tree and free it
+			 * A node with two children first trades places with it's in-order successor. It then has one child at
+			 * most: a single child is red and simply takes it's place, painted black; a leaf is rebalanced away
+			 * (see _removeFix) then unlinked. No value is copied or moved, so iterators to the other elements stay
+			 * valid.
+			 */
+			void 			_remove(node_pointer node) {
+				if (node == _header.left)
+					_header.left = inorderSuccessor(node);
+				if (node == _header.right)
+					_header.right = inorderPredecessor(node);
+				if (node->left != nullptr && node->right != nullptr) {
+					_swapWithSuccessor(node, min(node->right));
+					_updatePath(node);
 				}
-				if (_compare(root->data->first, node->data->first))
-					_remove(root->right, node);
-				else if (_compare(node->data->first, root->data->first))
-					_remove(root->left, node);
-				return ;
+
+				node_pointer	child = (node->left != nullptr) ? node->left : node->right;
+
+				if (child != nullptr) {
+					_transplant(node, child);
+					child->color = BLACK;
+					_updatePath(child->parent);
+				} else if (node == _header.parent)
+					_resetHeader();
+				else {
+					_removeFix(node);
+					_transplant(node, nullptr);
+					_updatePath(node->parent);
+				}
+				_destroyNode(node);
+			}
+			/** @brief Point the header at itself, as in an empty tree */
+			void	_resetHeader() {
+				_header.parent = nullptr;
+				_header.left = &_header;
+				_header.right = &_header;
 			}
 			void 			setColor(node_type *&node, Color color) {
 				if (node == nullptr)
@@ -381,10 +477,10 @@ namespace ft {
 					return BLACK;
 				return (node->color);
 			}
-			void 			_insertFix(node_type *&node) {
+			void 			_insertFix(node_pointer node) {
 				node_pointer parent = nullptr;
 				node_pointer grandparent = nullptr;
-				while (node != _root && getColor(node) == RED && getColor(node->parent) == RED) {
+				while (node != _header.parent && getColor(node) == RED && getColor(node->parent) == RED) {
 					parent = node->parent;
 					grandparent = parent->parent;
 					if (parent == grandparent->left) {
@@ -423,146 +519,300 @@ namespace ft {
 						}
 					}
 				}
-		    	_root->color = BLACK;
+		    	_header.parent->color = BLACK;
 			}
-			void 			_removeFix(node_pointer &node) {
-				if (node->color == RED) {
-					return ;
-				}
-				if (node == _root) {
-					node->color = BLACK;
-					return ;
-				}
+			/** @brief Rebalance the tree before the leaf node is unlinked
+			 * A black leaf leaves it's side of the tree one black short. Going up from it, a red sibling is first
+			 * rotated above the parent; then a black sibling with black children turns red and the shortage moves
+			 * up to the parent, otherwise one or two rotations around the parent settle it. The loop ends on a red
+			 * node, painted black, or on the root.
+			 */
+			void 			_removeFix(node_pointer node) {
+				while (node != _header.parent && getColor(node) == BLACK) {
+					node_pointer	parent = node->parent;
 
-				node_pointer sibling = (node && node->parent->left == node) ? (node->parent->right) : (node->parent->left);
-				if (sibling && sibling->color == BLACK) {
-					/** case 3: DB sibling is black and both sibling's childs are black
-					 *
-					 * 1	remove db
-					 * 2	make sibling red
-					 * 3	if db parent is red make it black else make it double black
-					 * 4	if parent becomes db then recurse
-					 */
-					if ((!sibling->left || sibling->left->color == BLACK) && (!sibling->right || sibling->right->color == BLACK)) {
-						node->color = BLACK;
-						sibling->color = RED;
-						if (node->parent->color == BLACK) {
-							node->parent->color = DBLACK;
-							_removeFix(node->parent);
-						} else {
-							node->parent->color = BLACK;
+					if (node == parent->left) {
+						node_pointer	sibling = parent->right;
+
+						if (getColor(sibling) == RED) {
+							sibling->color = BLACK;
+							parent->color = RED;
+							rotateLeft(parent);
+							sibling = parent->right;
 						}
-						return;
-					} if (node && node->parent->left == node) {
-						/**case4 sibling is black and nearest sibling child to db node is red
-						 * 1       swap sibling and red child colors
-						 * 2       rotate sibling in opposite direction of DB node
-						 * 3       will lead to case5 and get applied
-						 */
-						if ((sibling->left && sibling->left->color == RED) && (sibling->right && sibling->right->color == BLACK)) {
-							std::swap(sibling->left->color, sibling->color);
-							rotateRight(sibling);
-						} else if ((sibling->right && sibling->right->color == RED)){
-							/** case5 sibling is black and farthest child from db node is red
-							 * 1       swap parent and sibling colors
-							 * 2       rotate parent in direction of DB
-							 * 3       remove DB
-							 * 4       change sibling's far red child to black
-							 */
-							std::swap(node->parent->color, sibling->color);
-							rotateLeft(node->parent);
-							node->color = BLACK;
+						if (getColor(sibling->left) == BLACK && getColor(sibling->right) == BLACK) {
+							sibling->color = RED;
+							node = parent;
+						} else {
+							if (getColor(sibling->right) == BLACK) {
+								sibling->left->color = BLACK;
+								sibling->color = RED;
+								rotateRight(sibling);
+								sibling = parent->right;
+							}
+							sibling->color = parent->color;
+							parent->color = BLACK;
 							sibling->right->color = BLACK;
+							rotateLeft(parent);
+							node = _header.parent;
 						}
 					} else {
-						/** case4 sibling is black and nearest sibling child to db node is red
-						 * 1       swap sibling and red child colors
-						 * 2       rotate sibling in opposite direction of DB node
-						 * 3       will lead to case5 and get applied
-						 */
-						if ((sibling->right && sibling->right->color == RED) && (sibling->left && sibling->left->color == BLACK)) {
-							std::swap(sibling->right->color, sibling->color);
-							rotateLeft(sibling);
-						} else if (sibling->left && sibling->left->color == RED) {
-							/** case5 sibling is black and farthest child from db node is red
-							 * 1       swap parent and sibling colors
-							 * 2       rotate parent in direction of DB
-							 * 3       remove DB
-							 * 4       change sibling's far red child to black
-							 */
-							std::swap(node->parent->color, sibling->color);
-							rotateRight(node->parent);
-							node->color = BLACK;
+						node_pointer	sibling = parent->left;
+
+						if (getColor(sibling) == RED) {
+							sibling->color = BLACK;
+							parent->color = RED;
+							rotateRight(parent);
+							sibling = parent->left;
+						}
+						if (getColor(sibling->left) == BLACK && getColor(sibling->right) == BLACK) {
+							sibling->color = RED;
+							node = parent;
+						} else {
+							if (getColor(sibling->left) == BLACK) {
+								sibling->right->color = BLACK;
+								sibling->color = RED;
+								rotateLeft(sibling);
+								sibling = parent->left;
+							}
+							sibling->color = parent->color;
+							parent->color = BLACK;
 							sibling->left->color = BLACK;
+							rotateRight(parent);
+							node = _header.parent;
 						}
 					}
 				}
-				/** Sibling is red
-				 * swap sibling and parent colors
-				 * rotate parent is direction of DB node
-				 * recurse
-				 */
-				else if (sibling && sibling->color == RED) {
-					std::swap(node->parent->color, sibling->color);
-					if (node->parent->left == node) {
-						rotateLeft(node->parent);
-					} else {
-						rotateRight(node->parent);
-					}
-					_removeFix(node->parent);
-					return;
-				}
+				node->color = BLACK;
 			}
 
-			node_pointer	_find(node_pointer root, const key_type& data) const {
-				if (root == nullptr)
+			/** @brief Node whose key is equivalent to key, nullptr when there is none
+			 * key needs not be a key_type, only something _compare takes on either side of one: with a transparent
+			 * comparator, lookups by a char* in a tree of std::string build no string. The same goes for find,
+			 * lower_bound, upper_bound and equal_range.
+			 */
+			template <class K>
+			node_pointer	_find(node_pointer root, const K& data) const {
+				while (root != nullptr) {
+					if (_compare(root->data.first, data))
+						root = root->right;
+					else if (_compare(data, root->data.first))
+						root = root->left;
+					else
+						return (root);
+				}
+				return (nullptr);
+			}
+			/** @brief Build a balanced subtree from the next n values of a sorted range
+			 * The middle value becomes the root of the subtree, with the values before and after it built into it's
+			 * left and right subtrees the same way: the range is read in order, once. Subtree sizes differ by one at
+			 * most, so every level but the deepest is full; the nodes of that level are red, all others black.
+			 */
+			template <class ForwardIterator>
+			node_pointer	_build(ForwardIterator& first, size_type n, size_type depth, size_type red_depth) {
+				if (n == 0)
 					return (nullptr);
-				else if (_compare(root->data->first, data))
-					return (_find(root->right, data));
-				else if (_compare(data, root->data->first))
-					return (_find(root->left, data));
-				return (root);
+				node_pointer	left = _build(first, n / 2, depth + 1, red_depth);
+				node_pointer	node = create_node(*first);
+
+				++first;
+				node->left = left;
+				if (left != nullptr)
+					left->parent = node;
+				node->right = _build(first, n - n / 2 - 1, depth + 1, red_depth);
+				if (node->right != nullptr)
+					node->right->parent = node;
+				node->color = (depth == red_depth && depth != 0) ? RED : BLACK;
+				node_update::update(node);
+				return (node);
 			}
-			void	_copy(node_pointer root, const node_pointer src)
-			{
-				if(src == nullptr)
-					root = nullptr;
+
+			template <class InputIterator>
+			void	_insertRange(InputIterator first, InputIterator last, std::input_iterator_tag) {
+				for (; first != last; ++first)
+					insert(&_header, *first);
+			}
+			template <class ForwardIterator>
+			void	_insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type	n;
+
+				if (_size == 0 && _sortedUnique(first, last, n))
+					_assignSorted(first, n);
 				else
-				{
-					node_pointer	pt = nullptr;
-					if(src)
-						pt = create_node(*(src->data));
-					_root = _insert(_root, pt);
-					_copy(_root, src->left);
-					_copy(_root, src->right);
+					_insertRange(first, last, std::input_iterator_tag());
+			}
+
+			/** @brief Whether [first, last) is strictly increasing, n being set to it's length when it is
+			 */
+			template <class ForwardIterator>
+			bool	_sortedUnique(ForwardIterator first, ForwardIterator last, size_type& n) const {
+				n = 0;
+				if (first == last)
+					return (true);
+				for (ForwardIterator next = first; ++next != last; first = next, ++n)
+					if (!_compare((*first).first, (*next).first))
+						return (false);
+				n++;
+				return (true);
+			}
+
+			/** @brief Replace the content with the first n values of the sorted range at first
+			 */
+			template <class ForwardIterator>
+			void	_assignSorted(ForwardIterator first, size_type n) {
+				size_type	height = 0;
+
+				clear();
+				if (n == 0)
+					return ;
+				for (size_type m = n; m != 0; m >>= 1)
+					height++;
+				_header.parent = _build(first, n, 0, height - 1);
+				_header.parent->parent = &_header;
+				_header.left = min(_header.parent);
+				_header.right = max(_header.parent);
+				_size = n;
+			}
+			/** @brief Relink the next n nodes of list, threaded through their left link, into a balanced subtree
+			 * Shapes and colors the subtree exactly like _build, but out of existing nodes.
+			 */
+			node_pointer	_relink(node_pointer& list, size_type n, size_type depth, size_type red_depth) {
+				if (n == 0)
+					return (nullptr);
+				node_pointer	left = _relink(list, n / 2, depth + 1, red_depth);
+				node_pointer	node = list;
+
+				list = list->left;
+				node->left = left;
+				if (left != nullptr)
+					left->parent = node;
+				node->right = _relink(list, n - n / 2 - 1, depth + 1, red_depth);
+				if (node->right != nullptr)
+					node->right->parent = node;
+				node->color = (depth == red_depth && depth != 0) ? RED : BLACK;
+				node_update::update(node);
+				return (node);
+			}
+
+			/** @brief Free the nodes of [first, last) and rebalance the others from scratch
+			 * The tree is walked once in order, every node being threaded through it's left link on the list of the
+			 * nodes to keep or on the list of the nodes to free: the walk never reads the left link of a node it has
+			 * moved past. The nodes kept are then relinked into a balanced tree, in time linear in the size of the
+			 * tree whatever the position of the range.
+			 */
+			void	_eraseRebuild(node_pointer first, node_pointer last) {
+				node_pointer	kept = nullptr;
+				node_pointer	*kept_tail = &kept;
+				node_pointer	erased = nullptr;
+				node_pointer	*erased_tail = &erased;
+				size_type		n = 0;
+				size_type		height = 0;
+				bool			in_range = false;
+
+				for (node_pointer node = _header.left; node != &_header; ) {
+					node_pointer	next = inorderSuccessor(node);
+
+					if (node == first)
+						in_range = true;
+					else if (node == last)
+						in_range = false;
+					if (in_range) {
+						*erased_tail = node;
+						erased_tail = &node->left;
+					} else {
+						*kept_tail = node;
+						kept_tail = &node->left;
+						n++;
+					}
+					node = next;
+				}
+				*kept_tail = nullptr;
+				*erased_tail = nullptr;
+				while (erased != nullptr) {
+					node_pointer	next = erased->left;
+
+					_destroyNode(erased);
+					erased = next;
+				}
+				_resetHeader();
+				_size = n;
+				if (n == 0)
+					return ;
+				for (size_type m = n; m != 0; m >>= 1)
+					height++;
+				_header.parent = _relink(kept, n, 0, height - 1);
+				_header.parent->parent = &_header;
+				_header.left = min(_header.parent);
+				_header.right = max(_header.parent);
+			}
+			/** @brief Clone the tree rooted at src, node for node
+			 * Every node is copied with it's value and color and linked at the same place, so the copy has the exact
+			 * shape of the source without comparing any key. The source is walked in preorder through the parent
+			 * links, without any stack; a node's metadata is computed when the walk climbs back from it.
+			 *
+			 * @return The root of the copy
+			 */
+			node_pointer	_clone(node_pointer src) {
+				if (src == nullptr)
+					return (nullptr);
+				node_pointer	root = create_node(src->data);
+				node_pointer	from = src;
+				node_pointer	to = root;
+
+				root->color = src->color;
+				while (true) {
+					if (from->left != nullptr && to->left == nullptr) {
+						to->left = create_node(from->left->data);
+						to->left->color = from->left->color;
+						to->left->parent = to;
+						from = from->left;
+						to = to->left;
+					} else if (from->right != nullptr && to->right == nullptr) {
+						to->right = create_node(from->right->data);
+						to->right->color = from->right->color;
+						to->right->parent = to;
+						from = from->right;
+						to = to->right;
+					} else if (from != src) {
+						node_update::update(to);
+						from = from->parent;
+						to = to->parent;
+					} else {
+						node_update::update(to);
+						break ;
+					}
 				}
+				return (root);
 			}
 		public:
-			red_black_tree(): _root(nullptr), _size(0), _node_allocator(node_allocator()), _compare(key_compare()) {
+			red_black_tree(): _header(), _size(0), _node_allocator(node_allocator()), _compare(key_compare()) {
 				return ;
 			}
 
-			red_black_tree(const value_type &pair, const node_allocator& alloc = node_allocator(), const key_compare& compare = key_compare()): _root(create_node(pair)), _size(0), _node_allocator(alloc), _compare(compare) {
-				return ;
+			red_black_tree(const value_type &pair, const node_allocator& alloc = node_allocator(), const key_compare& compare = key_compare()): _header(), _size(0), _node_allocator(alloc), _compare(compare) {
+				insert(pair);
 			}
 
-			red_black_tree(const red_black_tree& x) {
-				if (this != &x)
-					*this = x;
+			red_black_tree(const red_black_tree& x): _header(), _size(0), _node_allocator(x._node_allocator), _compare(x._compare) {
+				*this = x;
 				return ;
 			}
 
 			~red_black_tree() {
+				clear();
 				return ;
 			}
 
 			red_black_tree&		operator=(const red_black_tree& x) {
-				if (_root != nullptr) {
-					_node_allocator.destroy(_root);
-					_node_allocator.deallocate(_root, 1);
-					_root = nullptr;
+				if (this == &x)
+					return (*this);
+				clear();
+				if (x._header.parent != nullptr) {
+					_header.parent = _clone(x._header.parent);
+					_header.parent->parent = &_header;
+					_header.left = min(_header.parent);
+					_header.right = max(_header.parent);
 				}
-				_copy(_root, x._root);
 				_size = x._size;
 				_compare = x._compare;
 				_node_allocator = x._node_allocator;
@@ -581,46 +831,51 @@ namespace ft {
 				return (_size == 0);
 			}
 			void 		clear() {
-				if (_root != nullptr) {
-					_destroyNode(_root);
-					_root = nullptr;
-					_size = 0;
-				}
+				_release(_header.parent, integral_constant<bool, has_release<node_allocator>::value>());
+				_resetHeader();
+				_size = 0;
 				return ;
 			}
-			node_pointer	max(node_pointer node) const {
+			static node_pointer	max(node_pointer node) {
 				if (node == nullptr)
 					return (node);
 				while (node->right != nullptr)
 					node = node->right;
 				return (node);
 			}
-			node_pointer	min(node_pointer node) const {
+			static node_pointer	min(node_pointer node) {
 				if (node == nullptr)
 					return (nullptr);
 				while (node->left != nullptr)
 					node = node->left;
 				return (node);
 			}
-			node_pointer	inorderPredecessor(node_pointer node) const {
-				if (node == nullptr)
-					return (nullptr);
+			/** @brief Node before node in order
+			 * The header comes before the leftmost node and after the rightmost one, so --end() is the rightmost node
+			 * and --begin() is end().
+			 */
+			static node_pointer	inorderPredecessor(node_pointer node) {
+				if (node->color == HEADER)
+					return (node->right);
 				if (node->left != nullptr)
 					return (max(node->left));
 				node_pointer	parent = node->parent;
-				while (parent != nullptr && parent->left == node) {
+				while (parent->color != HEADER && parent->left == node) {
 					node = parent;
 					parent = parent->parent;
 				}
 				return (parent);
 			}
-			node_pointer	inorderSuccessor(node_pointer node) const {
-				if (node == nullptr)
-					return (nullptr);
+			/** @brief Node after node in order
+			 * ++end() wraps around to begin().
+			 */
+			static node_pointer	inorderSuccessor(node_pointer node) {
+				if (node->color == HEADER)
+					return (node->left);
 				if (node->right != nullptr)
 					return (min(node->right));
 				node_pointer	parent = node->parent;
-				while (parent != nullptr && parent->right == node) {
+				while (parent->color != HEADER && parent->right == node) {
 					node = parent;
 					parent = parent->parent;
 				}
@@ -640,14 +895,16 @@ namespace ft {
 				if (node->right != nullptr)
 					node->right->parent = node;
 				rightChild->parent = node->parent;
-				if (node->parent == nullptr)
-					_root = rightChild;
+				if (node == _header.parent)
+					_header.parent = rightChild;
 				else if (node == node->parent->left)
 					node->parent->left = rightChild;
 				else
 					node->parent->right = rightChild;
 				rightChild->left = node;
 				node->parent = rightChild;
+				node_update::update(node);
+				node_update::update(rightChild);
 			}
 
 			/** @brief Implementing Tree Right rotation
@@ -663,58 +920,270 @@ namespace ft {
 				if (node->left != nullptr)
 					node->left->parent = node;
 				leftChild->parent = node->parent;
-				if (node->parent == nullptr)
-					_root = leftChild;
+				if (node == _header.parent)
+					_header.parent = leftChild;
 				else if (node == node->parent->left)
 					node->parent->left = leftChild;
 				else
 					node->parent->right = leftChild;
 				leftChild->right = node;
 				node->parent = leftChild;
+				node_update::update(node);
+				node_update::update(leftChild);
 			}
-			node_pointer	insert(const value_type& data) {
-				node_pointer node = _find(_root, data.first);
+			/** @brief Insert value unless it's key is already in the tree
+			 * @return The node holding the key, and whether it was inserted
+			 */
+			ft::pair<node_pointer, bool>	insert(const value_type& data) {
+				node_pointer	parent;
+				node_pointer	*link;
+				node_pointer	node = _descend(data.first, parent, link);
 
 				if (node != nullptr)
-					return (node);
-				node = create_node(data);
-				_root = _insert(_root, node);
-				_size++;
-				if (node->parent == nullptr) {
-					node->color = BLACK;
-					return (node);
+					return (ft::make_pair(node, false));
+				return (ft::make_pair(_attach(create_node(data), parent, link), true));
+			}
+
+			/** @brief Insert value, hint being the node (the header for end) it's key is expected to go right before
+			 * When the key belongs right before or right after hint, the node is attached next to it without any
+			 * search; the in-order neighbour of hint is found in amortized constant time, so are the rotations of
+			 * the fix up, and inserting sorted keys with end() as hint takes linear time overall. Otherwise falls
+			 * back to insert(data).
+			 *
+			 * @return The node holding the key, and whether it was inserted
+			 */
+			ft::pair<node_pointer, bool>	insert(node_pointer hint, const value_type& data) {
+				if (hint == &_header) {
+					if (_size != 0 && _compare(_header.right->data.first, data.first))
+						return (ft::make_pair(_attach(create_node(data), _header.right, &_header.right->right), true));
+				} else if (_compare(data.first, hint->data.first)) {
+					if (hint == _header.left)
+						return (ft::make_pair(_attach(create_node(data), hint, &hint->left), true));
+					node_pointer	prev = inorderPredecessor(hint);
+
+					if (_compare(prev->data.first, data.first)) {
+						if (prev->right == nullptr)
+							return (ft::make_pair(_attach(create_node(data), prev, &prev->right), true));
+						return (ft::make_pair(_attach(create_node(data), hint, &hint->left), true));
+					}
+				} else if (_compare(hint->data.first, data.first)) {
+					if (hint == _header.right)
+						return (ft::make_pair(_attach(create_node(data), hint, &hint->right), true));
+					node_pointer	next = inorderSuccessor(hint);
+
+					if (_compare(data.first, next->data.first)) {
+						if (hint->right == nullptr)
+							return (ft::make_pair(_attach(create_node(data), hint, &hint->right), true));
+						return (ft::make_pair(_attach(create_node(data), next, &next->left), true));
+					}
+				} else
+					return (ft::make_pair(hint, false));
+				return (insert(data));
+			}
+
+			/** @brief Insert the values of [first, last)
+			 * Into an empty tree, a forward range checked to be sorted without duplicates is built in linear time
+			 * (see assign_sorted). Any other range is inserted one value at a time with end() as hint, which is
+			 * linear as well for sorted input.
+			 */
+			template <class InputIterator>
+			void	insert_range(InputIterator first, InputIterator last) {
+				_insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+
+			/** @brief Replace the content with the values of a sorted range
+			 * Builds a perfectly balanced, correctly colored tree bottom up in linear time, without any comparison.
+			 * [first, last) must be sorted by the tree's comparison, without duplicates.
+			 */
+			template <class ForwardIterator>
+			void	assign_sorted(ForwardIterator first, ForwardIterator last) {
+				size_type	n = 0;
+
+				for (ForwardIterator it = first; it != last; ++it)
+					n++;
+				_assignSorted(first, n);
+			}
+
+			/** @brief Insert key with a mapped value built from args, unless key is already in the tree
+			 * args are left untouched when the key is found. The mapped value is constructed right in the new node,
+			 * it's type needs not be copyable.
+			 *
+			 * @return The node holding the key, and whether it was inserted
+			 */
+			template <class... Args>
+			ft::pair<node_pointer, bool>	try_emplace(const key_type& key, Args&&... args) {
+				node_pointer	parent;
+				node_pointer	*link;
+				node_pointer	node = _descend(key, parent, link);
+
+				if (node != nullptr)
+					return (ft::make_pair(node, false));
+				return (ft::make_pair(_attach(create_node(ft::piecewise_construct, key, std::forward<Args>(args)...), parent, link), true));
+			}
+			/** @brief Remove node, found beforehand, from the tree
+			 * No search is done; the rebalancing takes amortized constant time, plus O(log n) to update the path
+			 * to the root with an enabled node update policy.
+			 */
+			void			erase(node_pointer node) {
+				_remove(node);
+				_size--;
+			}
+			/** @brief Remove the nodes of [first, last), last being the header for end
+			 * The range is walked and unlinked node after node, each step taking amortized constant time. A range
+			 * holding more than half of the tree is instead freed at once, the rest being rebuilt around it (see
+			 * _eraseRebuild), and the whole tree goes through clear(): either way erasing k nodes takes O(log n + k).
+			 *
+			 * With an enabled node update policy, each unlinking also updates the path to the root in O(log n). The
+			 * tree is then rebuilt as soon as the range holds more than n / log n nodes, for O(min(k log n, n)).
+			 * Iterators to the nodes left stay valid.
+			 */
+			void			erase(node_pointer first, node_pointer last) {
+				size_type	n = 0;
+				size_type	limit = _size / 2;
+
+				if (first == _header.left && last == &_header) {
+					clear();
+					return ;
 				}
-				if (node->parent->parent == nullptr) {
-					return (node);
+				if (node_update::enabled) {
+					size_type	depth = 1;
+
+					for (size_type size = _size; size > 1; size >>= 1)
+						depth++;
+					limit = _size / depth;
+				}
+				for (node_pointer node = first; node != last && n <= limit; node = inorderSuccessor(node))
+					n++;
+				if (n > limit) {
+					_eraseRebuild(first, last);
+					return ;
+				}
+				while (first != last) {
+					node_pointer	next = inorderSuccessor(first);
+
+					erase(first);
+					first = next;
 				}
-				_insertFix(node);
-				return (_find(_root, data.first));
 			}
 			size_type		remove(const key_type& data) {
-				node_pointer node = _find(_root, data);
+				node_pointer node = _find(_header.parent, data);
 
 				if (node != nullptr) {
-					_remove(node, node);
-					_size--;
+					erase(node);
 					return (1);
 				}
 				return (0);
 			}
 
-			node_pointer	find(const key_type& data) const {
-				return (_find(_root, data));
+			template <class K>
+			node_pointer	find(const K& data) const {
+				return (_find(_header.parent, data));
+			}
+
+			/*
+			 * Order statistics, with ft::rbt_order_statistics_node_update: one descent or one climb each.
+			 */
+
+			/** @brief Node at index k in order, the header when k is not less than the size */
+			node_pointer	select(size_type k) const {
+				node_pointer	node = _header.parent;
+
+				while (node != nullptr) {
+					size_type	left = node_update::size(node->left);
+
+					if (k < left)
+						node = node->left;
+					else if (k == left)
+						return (node);
+					else {
+						k -= left + 1;
+						node = node->right;
+					}
+				}
+				return (const_cast<node_pointer>(&_header));
+			}
+			/** @brief Number of keys less than key */
+			size_type		rank(const key_type& key) const {
+				node_pointer	node = _header.parent;
+				size_type		n = 0;
+
+				while (node != nullptr) {
+					if (_compare(node->data.first, key)) {
+						n += node_update::size(node->left) + 1;
+						node = node->right;
+					} else
+						node = node->left;
+				}
+				return (n);
+			}
+			/** @brief Index of node in order, the size for the header */
+			size_type		rank(node_pointer node) const {
+				if (node->color == HEADER)
+					return (_size);
+				size_type	n = node_update::size(node->left);
+
+				for (; node->parent->color != HEADER; node = node->parent)
+					if (node == node->parent->right)
+						n += node_update::size(node->parent->left) + 1;
+				return (n);
+			}
+
+			/** @brief Fold the summaries of the keys in [lo, hi), with ft::rbt_aggregate_node_update
+			 * Descends to the highest node in the range, then from it along the paths to lo and to hi: the nodes
+			 * on the paths that fall in the range bring their subtree on the inner side along, so no more than two
+			 * paths are read.
+			 */
+			template <class Update = node_update>
+			typename Update::summary_type	aggregate(const key_type& lo, const key_type& hi) const {
+				typedef typename Update::monoid_type	monoid;
+
+				node_pointer	top = _header.parent;
+
+				while (top != nullptr) {
+					if (_compare(top->data.first, lo))
+						top = top->right;
+					else if (!_compare(top->data.first, hi))
+						top = top->left;
+					else
+						break ;
+				}
+				if (top == nullptr)
+					return (monoid::identity());
+
+				typename Update::summary_type	left = monoid::identity();
+				typename Update::summary_type	right = monoid::identity();
+
+				for (node_pointer node = top->left; node != nullptr; ) {
+					if (!_compare(node->data.first, lo)) {
+						left = monoid::combine(monoid::combine(monoid::summarize(node->data), Update::summary(node->right)), left);
+						node = node->left;
+					} else
+						node = node->right;
+				}
+				for (node_pointer node = top->right; node != nullptr; ) {
+					if (_compare(node->data.first, hi)) {
+						right = monoid::combine(right, monoid::combine(Update::summary(node->left), monoid::summarize(node->data)));
+						node = node->right;
+					} else
+						node = node->left;
+				}
+				return (monoid::combine(monoid::combine(left, monoid::summarize(top->data)), right));
+			}
+			/** @brief Update the metadata above node, after it's value was changed in place */
+			void			refresh(node_pointer node) {
+				_updatePath(node);
 			}
 			iterator		begin() {
-				return (iterator(min(_root), this));
+				return (iterator(_header.left));
 			}
 			const_iterator	begin() const {
-				return (iterator(min(_root), this));
+				return (const_iterator(_header.left));
 			}
 			iterator 	end() {
-				return (iterator(nullptr, this));
+				return (iterator(&_header));
 			}
 			const_iterator 	end() const {
-				return (iterator(nullptr, this));
+				return (const_iterator(const_cast<node_pointer>(&_header)));
 			}
 			reverse_iterator	rbegin(){
 				return (reverse_iterator(end()));
@@ -728,33 +1197,64 @@ namespace ft {
 			const_reverse_iterator rend() const {
 				return (const_reverse_iterator(begin()));
 			}
-			iterator findSuccessor(const key_type& k) {
-				node_pointer successor = nullptr;
-				node_pointer root = _root;
+			/** @brief First node whose key is not less than key, the header when there is none
+			 * One descent, one comparison per level.
+			 */
+			template <class K>
+			node_pointer	lower_bound(const K& key) const {
+				node_pointer	bound = const_cast<node_pointer>(&_header);
+				node_pointer	node = _header.parent;
+
+				while (node != nullptr) {
+					if (!_compare(node->data.first, key)) {
+						bound = node;
+						node = node->left;
+					} else
+						node = node->right;
+				}
+				return (bound);
+			}
+			/** @brief First node whose key is greater than key, the header when there is none
+			 * One descent, one comparison per level.
+			 */
+			template <class K>
+			node_pointer	upper_bound(const K& key) const {
+				node_pointer	bound = const_cast<node_pointer>(&_header);
+				node_pointer	node = _header.parent;
 
-				while (root != nullptr) {
-					if (_compare(k, root->data->first)) {
-						successor = root;
-						root = root->left;
-					}
-					else if (!_compare(k, root->data->first))
-						root = root->right;
+				while (node != nullptr) {
+					if (_compare(key, node->data.first)) {
+						bound = node;
+						node = node->left;
+					} else
+						node = node->right;
 				}
-				return (iterator(successor, this));
+				return (bound);
 			}
-			const_iterator findSuccessor(const key_type& k) const {
-				node_pointer successor = nullptr;
-				node_pointer root = _root;
+			/** @brief lower_bound and upper_bound of key, in one descent
+			 * Both searches follow the same path down to the node holding key. Keys being unique, that node is the
+			 * lower bound, and the upper bound is the leftmost node of it's right subtree, or the last node the path
+			 * went left at when it has none. Without such a node both bounds are the same. A key of another type may
+			 * be equivalent to several keys of the tree: search it's bounds with lower_bound and upper_bound instead.
+			 */
+			template <class K>
+			ft::pair<node_pointer, node_pointer>	equal_range(const K& key) const {
+				node_pointer	bound = const_cast<node_pointer>(&_header);
+				node_pointer	node = _header.parent;
 
-				while (root != nullptr) {
-					if (_compare(k, root->data->first)) {
-						successor = root;
-						root = root->left;
+				while (node != nullptr) {
+					if (_compare(key, node->data.first)) {
+						bound = node;
+						node = node->left;
+					} else if (_compare(node->data.first, key))
+						node = node->right;
+					else {
+						for (node_pointer next = node->right; next != nullptr; next = next->left)
+							bound = next;
+						return (ft::make_pair(node, bound));
 					}
-					else if (!_compare(k, root->data->first))
-						root = root->right;
 				}
-				return (const_iterator(successor, this));
+				return (ft::make_pair(bound, bound));
 			}
 			void print_helper(const std::string &prefix, const node_pointer node, bool isLeft)
 			{
@@ -765,9 +1265,9 @@ namespace ft {
 					std::cout << (isLeft ? "├──" : "└──");
 
 					// print the value of the node
-					std::cout << node->data->first << " ";
+					std::cout << node->data.first << " ";
 
-					if (node == this->_root)
+					if (node == this->_header.parent)
 						std::cout << "(Root)" << std::endl;
 					else
 						std::cout << (isLeft ? "(R)" : "(L)") << ((node->color == 1) ? "(Red)" : "(Black)") << std::endl;
@@ -777,16 +1277,26 @@ namespace ft {
 				}
 			}
 			node_pointer	getRoot() const {
-				return (_root);
+				return (_header.parent);
 			}
 			void print()
 			{
-				if (_root == nullptr)
+				if (_header.parent == nullptr)
 					return ;
-				print_helper("", _root, false);
+				print_helper("", _header.parent, false);
 			}
 			void	swap(red_black_tree &x) {
-				std::swap(_root, x._root);
+				std::swap(_header.parent, x._header.parent);
+				std::swap(_header.left, x._header.left);
+				std::swap(_header.right, x._header.right);
+				if (_header.parent != nullptr)
+					_header.parent->parent = &_header;
+				else
+					_resetHeader();
+				if (x._header.parent != nullptr)
+					x._header.parent->parent = &x._header;
+				else
+					x._resetHeader();
 				std::swap(_size, x._size);
 				std::swap(_compare, x._compare);
 				std::swap(_node_allocator, x._node_allocator);
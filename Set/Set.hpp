@@ -37,8 +37,11 @@ namespace ft {
 	 * @tparam T
 	 * @tparam Compare
 	 * @tparam Alloc
+	 * @tparam NodeUpdate Node update policy of the red black tree (see node_update.hpp): with
+	 * ft::rbt_order_statistics_node_update, nth, rank, count_range and distance take logarithmic time, with
+	 * ft::rbt_aggregate_node_update, aggregate does.
 	 */
-	template < class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	template < class T, class Compare = std::less<T>, class Alloc = std::allocator<T>, class NodeUpdate = ft::rbt_null_node_update >
 		class Set {
 		public:
 			typedef T																	value_type;
@@ -57,9 +60,9 @@ namespace ft {
 			// 		return key_compare()(x.first, y.first);
 			// 	}
 			// };
-			typedef ft::Node<value_type, allocator_type>								node_type;
+			typedef ft::Node<value_type, allocator_type, NodeUpdate>					node_type;
 			typedef node_type*															node_pointer;
-			typedef ft::red_black_tree<value_type, key_compare, allocator_type>			tree_type;
+			typedef ft::red_black_tree<value_type, key_compare, allocator_type, NodeUpdate>	tree_type;
 			typedef ft::rbt_iterator<value_type, node_type, tree_type>					iterator;
 			typedef ft::rbt_iterator<const value_type, node_type, tree_type >			const_iterator;
 			typedef ft::rbt_reverse_iterator<iterator>									reverse_iterator;
@@ -89,17 +92,22 @@ namespace ft {
 
 			template <class InputIterator>
 					Set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _rbtree(), _compare(comp), _alloc(alloc), _value_compare(comp) {
-						for (InputIterator it = first; it != last ; it++) {
-							_rbtree.insert(*it);
-						}
+						_rbtree.insert_range(first, last);
+						return ;
+					}
+
+			/** @brief Construct from a sorted range
+			 * [first, last) must be sorted by comp without duplicates, the tree is then built in linear time without
+			 * comparing any element.
+			 */
+			template <class ForwardIterator>
+					Set (ft::sorted_unique_t, ForwardIterator first, ForwardIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _rbtree(), _compare(comp), _alloc(alloc), _value_compare(comp) {
+						_rbtree.assign_sorted(first, last);
 						return ;
 					}
 
-			Set (const Set& x): _rbtree(), _compare(key_compare()), _alloc(allocator_type()), _value_compare(key_compare()) {
-				if (this == &x)
-					return ;
-				_rbtree.clear();
-				_rbtree = x._rbtree;
+			Set (const Set& x): _rbtree(x._rbtree), _compare(x._compare), _alloc(x._alloc), _value_compare(x._value_compare) {
+				return ;
 			}
 
 			/** @brief Set destructor
@@ -128,7 +136,7 @@ namespace ft {
 			 * @return  *this
 			 */
 			Set& operator= (const Set& x) {
-				if (*this != x) {
+				if (this != &x) {
 					_rbtree = x._rbtree;
 					_alloc = x._alloc;
 					_compare = x._compare;
@@ -255,21 +263,16 @@ namespace ft {
 			 * @return
 			 */
 			ft::pair<iterator, bool>	insert (const value_type& val) {
-				node_pointer node = _rbtree.find(val);
+				ft::pair<node_pointer, bool>	inserted = _rbtree.insert(val);
 
-				if (node != nullptr)
-					return (ft::make_pair(iterator(node, &_rbtree), false));
-				return (ft::make_pair(iterator(_rbtree.insert(val), &_rbtree), true));
+				return (ft::make_pair(iterator(inserted.first), inserted.second));
 			}
 			iterator 					insert (iterator position, const value_type& val) {
-				(void) position;
-				return (iterator(_rbtree.insert(val), &_rbtree));
+				return (iterator(_rbtree.insert(position.getNode(), val).first));
 			}
 			template <class InputIterator>
 					void 				insert (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()) {
-						for (InputIterator it = first; it != last; it++) {
-							_rbtree.insert(*it);
-						}
+						_rbtree.insert_range(first, last);
 					}
 
 
@@ -286,17 +289,31 @@ namespace ft {
 			 * @return For the value-based version, the function returns the number of elements erased.
 			 */
 			 void 	erase(iterator position) {
-				 _rbtree.remove(*position);
+				 _rbtree.erase(position.getNode());
 			 }
 			 size_type	erase(const value_type &val) {
 				 return (_rbtree.remove(val));
 			 }
+			 /** @brief Erase the elements equivalent to k, which needs not be a value_type
+			  * Only with a transparent comparator (see ft::is_transparent), and for k neither an iterator nor a
+			  * const_iterator, erasing by position staying erase(iterator).
+			  *
+			  * @param k Value to compare.
+			  * @return The number of elements erased.
+			  */
+			 template <class K, class C = Compare>
+			 typename ft::enable_if<ft::is_transparent<C>::value && !std::is_convertible<K, iterator>::value
+				 && !std::is_convertible<K, const_iterator>::value, size_type>::type	erase(const K& k) {
+				 ft::pair<iterator, iterator>	range = equal_range(k);
+				 size_type						n = 0;
+
+				 for (iterator it = range.first; it != range.second; ++it)
+					 ++n;
+				 erase(range.first, range.second);
+				 return (n);
+			 }
 			 void 		erase(iterator first, iterator last) {
-				 ft::Vector<key_type> keys;
-				for(iterator it = first; it != last; ++it)
-					keys.push_back(*it);
-				for (typename ft::Vector<key_type>::iterator it = keys.begin(); it != keys.end(); ++it)
-					_rbtree.remove(*it);
+				 _rbtree.erase(first.getNode(), last.getNode());
 			 }
 
 			 /** @brief Swap content
@@ -396,8 +413,8 @@ namespace ft {
 					node_pointer node = _rbtree.find(val);
 
 					if (node != nullptr)
-						return (iterator(node, &_rbtree));
-					return (iterator(nullptr, &_rbtree));
+						return (iterator(node));
+					return (iterator(_rbtree.end().getNode()));
 				  }
 
 
@@ -437,11 +454,7 @@ namespace ft {
 				    * @complixity Logarithmic in size.
 				    */
 				    iterator lower_bound(const value_type& val) const {
-						iterator it = find(val);
-
-						if (it != end())
-							return (it);
-						return (_rbtree.findSuccessor(val));
+						return (iterator(_rbtree.lower_bound(val)));
 					}
 
 					/** @brief Return iterator to upper bound
@@ -459,7 +472,7 @@ namespace ft {
 					 * @complixity Logarithmic in size.
 					 */
 					 iterator 	upper_bound (const value_type& val) const{
-						 return (_rbtree.findSuccessor(val));
+						 return (iterator(_rbtree.upper_bound(val)));
 					 }
 					//  const_iterator 	upper_bound (const value_type& val) const {
 					// 	 return (_rbtree.findSuccessor(val));
@@ -483,12 +496,119 @@ namespace ft {
 					 * (the same as lower_bound), and pair::second is the upper bound (the same as upper_bound).
 					 */
 					ft::pair<iterator, iterator> equal_range (const value_type& val) const {
-						 return (ft::make_pair(lower_bound(val), upper_bound(val)));
+						 ft::pair<node_pointer, node_pointer>	range = _rbtree.equal_range(val);
+
+						 return (ft::make_pair(iterator(range.first), iterator(range.second)));
 					 }
+
+					/** @brief Heterogeneous lookups
+					 * With a transparent comparator (see ft::is_transparent), find, count, lower_bound, upper_bound and
+					 * equal_range also take anything the comparator compares with value_type, and never convert it to
+					 * one: with ft::Set<std::string, std::less<> >, find("value") builds no std::string.
+					 *
+					 * Several elements may be equivalent to such a k: find returns any of them, count and equal_range
+					 * cover them all.
+					 *
+					 * @param k Value to compare.
+					 * @complixity Logarithmic in size, plus the number of elements counted for count.
+					 */
+					template <class K, class C = Compare>
+					typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type	find(const K& k) const {
+						node_pointer node = _rbtree.find(k);
+
+						if (node != nullptr)
+							return (iterator(node));
+						return (iterator(_rbtree.end().getNode()));
+					}
+					template <class K, class C = Compare>
+					typename ft::enable_if<ft::is_transparent<C>::value, size_type>::type	count(const K& k) const {
+						ft::pair<iterator, iterator>	range = equal_range(k);
+						size_type						n = 0;
+
+						for (; range.first != range.second; ++range.first)
+							++n;
+						return (n);
+					}
+					template <class K, class C = Compare>
+					typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type	lower_bound(const K& k) const {
+						return (iterator(_rbtree.lower_bound(k)));
+					}
+					template <class K, class C = Compare>
+					typename ft::enable_if<ft::is_transparent<C>::value, iterator>::type	upper_bound(const K& k) const {
+						return (iterator(_rbtree.upper_bound(k)));
+					}
+					template <class K, class C = Compare>
+					typename ft::enable_if<ft::is_transparent<C>::value, ft::pair<iterator, iterator> >::type
+						equal_range(const K& k) const {
+						return (ft::make_pair(lower_bound(k), upper_bound(k)));
+					}
 					// ft::pair<const_iterator, const_iterator> equal_range (const value_type& val) const {
 					// 	 return (ft::make_pair(lower_bound(val), upper_bound(val)));
 					// }
 
+					/** @brief Get element by index
+					 * Returns an iterator to the element at index k in the order of the set. Requires
+					 * ft::rbt_order_statistics_node_update, as rank, count_range and distance do.
+					 *
+					 * @param k Index of the element.
+					 * @return An iterator to the element, or set::end if k is not less than set::size.
+					 * @complixity Logarithmic in size.
+					 */
+					iterator	nth(size_type k) const {
+						return (iterator(_rbtree.select(k)));
+					}
+
+					/** @brief Get index of a value
+					 * Returns the number of elements in the container which are considered to go before val, which is
+					 * the index of val when it is in the set.
+					 *
+					 * @param val Value to compare.
+					 * @return The number of elements before val.
+					 * @complixity Logarithmic in size.
+					 */
+					size_type	rank(const value_type& val) const {
+						return (_rbtree.rank(val));
+					}
+
+					/** @brief Count elements in a range of values
+					 * Returns the number of elements in the container which are not considered to go before lo, and
+					 * are considered to go before hi.
+					 *
+					 * @param lo Lower bound of the range, included.
+					 * @param hi Upper bound of the range, excluded.
+					 * @return The number of elements in [lo, hi).
+					 * @complixity Logarithmic in size.
+					 */
+					size_type	count_range(const value_type& lo, const value_type& hi) const {
+						if (!_compare(lo, hi))
+							return (0);
+						return (_rbtree.rank(hi) - _rbtree.rank(lo));
+					}
+
+					/** @brief Distance between iterators
+					 * Returns the number of increments needed to go from first to last, negative when last comes before
+					 * first.
+					 *
+					 * @complixity Logarithmic in size.
+					 */
+					difference_type	distance(const_iterator first, const_iterator last) const {
+						return (static_cast<difference_type>(_rbtree.rank(last.getNode())) - static_cast<difference_type>(_rbtree.rank(first.getNode())));
+					}
+
+					/** @brief Fold a range of values
+					 * Combines the summaries of the elements which are not considered to go before lo, and are
+					 * considered to go before hi, in order. Requires ft::rbt_aggregate_node_update<Monoid>.
+					 *
+					 * @param lo Lower bound of the range, included.
+					 * @param hi Upper bound of the range, excluded.
+					 * @return The summary of the range, Monoid::identity() if it is empty.
+					 * @complixity Logarithmic in size.
+					 */
+					template <class Update = NodeUpdate>
+					typename Update::summary_type	aggregate(const value_type& lo, const value_type& hi) const {
+						return (_rbtree.template aggregate<Update>(lo, hi));
+					}
+
 					 /** @brief Get allocator
 					  * Returns a copy of the allocator object associated with the set.
 					  *
@@ -497,42 +617,42 @@ namespace ft {
 					  */
 					  allocator_type	get_allocator() const { return (_alloc);};
 	};
-	template <class T, class Compare, class Alloc>
-	bool operator== ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator== ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							if (lhs.size() != rhs.size())
 								return (lhs.size() == rhs.size());
 							return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 						}
-	template <class T, class Compare, class Alloc>
-	bool operator!= ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator!= ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (!(lhs == rhs));
 						}
-	template <class T, class Compare, class Alloc>
-	bool operator<  ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator<  ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 						}
-	template <class T, class Compare, class Alloc>
-	bool operator<= ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator<= ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							if (lhs < rhs || lhs == rhs)
             					return (true);
         					return (false);
 						}
-	template <class T, class Compare, class Alloc>
-	bool operator>  ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator>  ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (!(lhs <= rhs));
 						}
-	template <class T, class Compare, class Alloc>
-	bool operator>= ( const Set<T,Compare,Alloc>& lhs,
-						const Set<T,Compare,Alloc>& rhs ) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+	bool operator>= ( const Set<T,Compare,Alloc,NodeUpdate>& lhs,
+						const Set<T,Compare,Alloc,NodeUpdate>& rhs ) {
 							return (!(lhs < rhs));
 						}
-	template <class T, class Compare, class Alloc>
-  		void swap (Set<T,Compare,Alloc>& x, Set<T,Compare,Alloc>& y) {
+	template <class T, class Compare, class Alloc, class NodeUpdate>
+  		void swap (Set<T,Compare,Alloc,NodeUpdate>& x, Set<T,Compare,Alloc,NodeUpdate>& y) {
 			  x.swap(y);
 			  return ;
 		  }
@@ -15,6 +15,7 @@
 #include "Set.hpp"       // your Map path.
 #include "../Vector/Vector.hpp" // your Vector path.
 #include "../utils/pair.hpp"  // path to ft::pair.
+#include "../utils/pool_allocator.hpp"
 // #include "map-test-helper.hpp"
 #include <set>
 
@@ -70,6 +71,38 @@ bool compareMaps(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2)
 
 bool fncomp(char lhs, char rhs) { return lhs < rhs; }
 
+struct SumOfValues
+{
+    typedef long long summary_type;
+    static long long identity() { return 0; }
+    static long long summarize(const int &x) { return x; }
+    static long long combine(long long lhs, long long rhs) { return lhs + rhs; }
+};
+
+/*
+ * A summary owning heap memory, counting it's live instances
+ */
+struct Tracked
+{
+    static long live;
+    std::string s;
+
+    Tracked() { ++live; }
+    Tracked(const std::string &str) : s(str) { ++live; }
+    Tracked(const Tracked &x) : s(x.s) { ++live; }
+    ~Tracked() { --live; }
+    Tracked &operator=(const Tracked &x) { s = x.s; return (*this); }
+};
+long Tracked::live = 0;
+
+struct ConcatOfValues
+{
+    typedef Tracked summary_type;
+    static Tracked identity() { return Tracked(); }
+    static Tracked summarize(const int &x) { return Tracked(std::string(20, 'a' + x)); }
+    static Tracked combine(const Tracked &lhs, const Tracked &rhs) { return Tracked(lhs.s + rhs.s); }
+};
+
 struct classcomp
 {
     bool operator()(const char &lhs, const char &rhs) const
@@ -78,6 +111,21 @@ struct classcomp
     }
 };
 
+struct Initial
+{
+    char c;
+};
+
+struct NameLess
+{
+    typedef void is_transparent;
+    bool operator()(const std::string &lhs, const std::string &rhs) const { return lhs < rhs; }
+    bool operator()(const std::string &lhs, const char *rhs) const { return lhs.compare(rhs) < 0; }
+    bool operator()(const char *lhs, const std::string &rhs) const { return rhs.compare(lhs) > 0; }
+    bool operator()(const std::string &lhs, Initial rhs) const { return lhs[0] < rhs.c; }
+    bool operator()(Initial lhs, const std::string &rhs) const { return lhs.c < rhs[0]; }
+};
+
 bool testMapConstructors()
 {
     bool cond;
@@ -514,6 +562,40 @@ void testConstructors()
             my_sum1 += *it;
         EQUAL(my_sum == sum && my_sum == my_sum1);
     }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " sorted range constructor "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond = true;
+
+        for (int n = 0; n < 300; n += 7) {
+            ft::Vector<int> v;
+            std::set<int> s;
+
+            for (int i = 0; i < n; ++i) {
+                v.push_back(i * 3);
+                s.insert(i * 3);
+            }
+            ft::Set<int> sorted(ft::sorted_unique, v.begin(), v.end());
+            ft::Set<int> detected(v.begin(), v.end());
+
+            sorted.erase(3);
+            sorted.insert(3);
+            sorted.insert(n * 3 + 1);
+            s.insert(3);
+            s.insert(n * 3 + 1);
+            cond = cond && sorted.size() == s.size() && compareMaps(sorted.begin(), sorted.end(), s.begin(), s.end())
+                && detected.size() == static_cast<size_t>(n);
+        }
+        ft::Vector<int> u;
+        std::set<int> s;
+        for (int i = 0; i < 1000; ++i) {
+            u.push_back((i * 7919) % 500);
+            s.insert((i * 7919) % 500);
+        }
+        ft::Set<int> unsorted(u.begin(), u.end());
+        cond = cond && unsorted.size() == s.size() && compareMaps(unsorted.begin(), unsorted.end(), s.begin(), s.end());
+        EQUAL(cond);
+    }
     std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy constructor "
               << "] --------------------]\t\t\033[0m";
     {
@@ -1190,6 +1272,115 @@ void testModifiers()
         EQUAL(cond);
     }
 
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert with hint "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> m;
+        ft::Set<int> ft_m;
+
+        for (int i = 0; i < 5000; ++i) {
+            m.insert(m.end(), i * 2);
+            ft_m.insert(ft_m.end(), i * 2);
+        }
+        for (int i = -1; i > -5000; --i) {
+            m.insert(m.begin(), i);
+            ft_m.insert(ft_m.begin(), i);
+        }
+        bool cond = compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        for (int i = 0; i < 5000; ++i) {
+            int key = (i * 7919) % 10001;
+
+            cond = cond && *ft_m.insert(ft_m.lower_bound(key + (i % 3) * 100), key) == *m.insert(m.lower_bound(key + (i % 3) * 100), key);
+        }
+        cond = cond && compareMaps(ft_m.begin(), ft_m.end(), m.begin(), m.end());
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " begin, end and their neighbours "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::Set<int> ft_s;
+        bool cond = ft_s.begin() == ft_s.end() && ft_s.rbegin() == ft_s.rend();
+
+        // the extremes move as values come and go, --end() and rbegin() follow them
+        for (int i = 0; i < 2000; ++i) {
+            if (i % 3 == 2 && s.size() > 2) {
+                s.erase(s.begin());
+                ft_s.erase(ft_s.begin());
+                s.erase(*s.rbegin());
+                ft_s.erase(--ft_s.end());
+            } else {
+                s.insert((i * 7919) % 1500);
+                ft_s.insert((i * 7919) % 1500);
+            }
+            cond = cond && *ft_s.begin() == *s.begin() && *(--ft_s.end()) == *(--s.end())
+                && *ft_s.rbegin() == *s.rbegin() && *(--ft_s.rend()) == *(--s.rend());
+        }
+        ft_s.clear();
+        cond = cond && ft_s.begin() == ft_s.end();
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase keeps other iterators valid "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::Set<int> ft_s;
+        ft::Vector<ft::Set<int>::iterator> its;
+        bool cond = true;
+
+        for (int i = 0; i < 3000; ++i) {
+            s.insert(i);
+            its.push_back(ft_s.insert(i).first);
+        }
+        // erase every other value, inner nodes included, through an iterator or by value
+        for (int i = 0; i < 3000; i += 2) {
+            s.erase(i);
+            if (i % 4)
+                ft_s.erase(its[i]);
+            else
+                ft_s.erase(i);
+        }
+        for (int i = 1; i < 3000; i += 2)
+            cond = cond && *its[i] == i;
+        cond = cond && compareMaps(ft_s.begin(), ft_s.end(), s.begin(), s.end());
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase a large range "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::Set<int> ft_s;
+        bool cond = true;
+
+        for (int i = 0; i < 10000; ++i) {
+            s.insert(s.end(), i);
+            ft_s.insert(ft_s.end(), i);
+        }
+        ft::Set<int>::iterator kept = ft_s.find(9000);
+        // most of the set at once, then a window sliding over what is left
+        s.erase(s.begin(), s.lower_bound(7000));
+        ft_s.erase(ft_s.begin(), ft_s.lower_bound(7000));
+        cond = cond && *kept == 9000 && compareMaps(ft_s.begin(), ft_s.end(), s.begin(), s.end());
+        for (int i = 10000; i < 12000; i += 100) {
+            for (int j = i; j < i + 100; ++j) {
+                s.insert(s.end(), j);
+                ft_s.insert(ft_s.end(), j);
+            }
+            s.erase(s.begin(), s.lower_bound(i - 2500));
+            ft_s.erase(ft_s.begin(), ft_s.lower_bound(i - 2500));
+            cond = cond && ft_s.size() == s.size();
+        }
+        s.erase(s.find(11000), s.end());
+        ft_s.erase(ft_s.find(11000), ft_s.end());
+        cond = cond && compareMaps(ft_s.begin(), ft_s.end(), s.begin(), s.end());
+        ft_s.erase(ft_s.begin(), ft_s.end());
+        cond = cond && ft_s.empty() && ft_s.begin() == ft_s.end();
+        EQUAL(cond);
+    }
+
     std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase method "
               << "] --------------------]\t\t\033[0m";
 
@@ -1961,6 +2152,107 @@ void testOperations()
         cond = (cond && (*(ft_res.first) == *(res.first)) && (*(ft_res.second) == *(res.second)));
         EQUAL(cond);
     }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " nth, rank, count_range, distance "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::Set<int, std::less<int>, std::allocator<int>, ft::rbt_order_statistics_node_update> ft_s;
+        bool cond = true;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            s.insert((i * 7919) % 10007);
+            ft_s.insert((i * 7919) % 10007);
+        }
+        for (int i = 0; i < 5000; i += 3)
+        {
+            s.erase((i * 7919) % 10007);
+            ft_s.erase((i * 7919) % 10007);
+        }
+        s.erase(s.lower_bound(2000), s.lower_bound(8000));
+        ft_s.erase(ft_s.lower_bound(2000), ft_s.lower_bound(8000));
+        size_t index = 0;
+        for (std::set<int>::iterator it = s.begin(); it != s.end(); ++it, ++index)
+            cond = cond && *ft_s.nth(index) == *it && ft_s.rank(*it) == index;
+        cond = cond && ft_s.nth(s.size()) == ft_s.end() && ft_s.distance(ft_s.begin(), ft_s.end()) == (long)s.size();
+        for (int lo = -10; lo < 10020; lo += 97)
+        {
+            int hi = lo + (lo * 31) % 3000;
+
+            cond = cond && ft_s.count_range(lo, hi) == (size_t)std::distance(s.lower_bound(lo), s.lower_bound(hi));
+            cond = cond && ft_s.rank(lo) == (size_t)std::distance(s.begin(), s.lower_bound(lo));
+        }
+        cond = cond && ft_s.count_range(100, 10) == 0;
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " aggregate "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<int> s;
+        ft::Set<int, std::less<int>, std::allocator<int>, ft::rbt_aggregate_node_update<SumOfValues> > ft_s;
+        bool cond = true;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            s.insert((i * 7919) % 10007);
+            ft_s.insert((i * 7919) % 10007);
+        }
+        s.erase(s.lower_bound(2000), s.lower_bound(8000));
+        ft_s.erase(ft_s.lower_bound(2000), ft_s.lower_bound(8000));
+        for (int lo = -10; lo < 10020; lo += 97)
+        {
+            int hi = lo + (lo * 31) % 3000;
+            long long sum = 0;
+
+            for (std::set<int>::iterator it = s.lower_bound(lo); lo < hi && it != s.lower_bound(hi); ++it)
+                sum += *it;
+            cond = cond && ft_s.aggregate(lo, hi) == sum;
+        }
+        EQUAL(cond);
+    }
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " transparent comparator "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::set<std::string> s;
+        ft::Set<std::string, NameLess> ft_s;
+        char buf[16];
+        bool cond = true;
+
+        for (int i = 0; i < 3000; i++)
+        {
+            snprintf(buf, sizeof(buf), "%c%d", 'a' + (i * 7) % 26, (i * 31) % 997);
+            s.insert(buf);
+            ft_s.insert(buf);
+        }
+        for (int i = 0; i < 4000; i++)
+        {
+            snprintf(buf, sizeof(buf), "%c%d", 'a' + (i * 5) % 27, (i * 13) % 1100);
+            const char *k = buf;
+            std::set<std::string>::iterator lb = s.lower_bound(k), ub = s.upper_bound(k);
+
+            cond = cond && (ft_s.find(k) == ft_s.end()) == (s.find(k) == s.end()) && ft_s.count(k) == s.count(k);
+            cond = cond && (ft_s.lower_bound(k) == ft_s.end() ? lb == s.end() : lb != s.end() && *ft_s.lower_bound(k) == *lb);
+            cond = cond && (ft_s.upper_bound(k) == ft_s.end() ? ub == s.end() : ub != s.end() && *ft_s.upper_bound(k) == *ub);
+            cond = cond && ft_s.equal_range(k).first == ft_s.lower_bound(k) && ft_s.equal_range(k).second == ft_s.upper_bound(k);
+        }
+        for (char c = 'a'; c <= 'z'; c += 3)
+        {
+            Initial initial = {c};
+            size_t n = 0;
+
+            for (std::set<std::string>::iterator it = s.begin(); it != s.end();)
+                if ((*it)[0] == c && ++n)
+                    s.erase(it++);
+                else
+                    ++it;
+            cond = cond && ft_s.count(initial) == n && ft_s.erase(initial) == n && ft_s.count(initial) == 0;
+        }
+        cond = cond && ft_s.size() == s.size() && std::equal(s.begin(), s.end(), ft_s.begin());
+        EQUAL(cond);
+    }
 }
 
 void testAllocatorMethodes()
@@ -1979,6 +2271,60 @@ void testAllocatorMethodes()
         EQUAL(psize == 5);
         mymap.get_allocator().deallocate(p, 5);
     }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " pool allocator "
+              << "] --------------------]\t\t\033[0m";
+    {
+        typedef ft::Set<int, std::less<int>, ft::PoolAllocator<int> > pool_set;
+        pool_set myset;
+        std::set<int> s;
+        bool cond = true;
+
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 2000; ++i) {
+                myset.insert((i * 7919) % 2000);
+                s.insert((i * 7919) % 2000);
+            }
+            for (int i = round; i < 2000; i += 2) {
+                myset.erase(i);
+                s.erase(i);
+            }
+        }
+        pool_set copy(myset);
+        pool_set other;
+
+        other.insert(-1);
+        other.swap(copy);
+        cond = (myset.size() == s.size() && other.size() == s.size() && copy.size() == 1 && *copy.begin() == -1);
+        std::set<int>::iterator it = s.begin();
+        for (pool_set::iterator ft_it = other.begin(); cond && ft_it != other.end(); ++ft_it, ++it)
+            cond = (*ft_it == *it);
+        myset.clear();
+        for (int i = 0; i < 100; ++i)
+            myset.insert(i);
+        cond = cond && myset.size() == 100 && myset.count(42) == 1;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " pool allocator with node metadata "
+              << "] --------------------]\t\t\033[0m";
+    {
+        typedef ft::Set<int, std::less<int>, ft::PoolAllocator<int>, ft::rbt_aggregate_node_update<ConcatOfValues> > pool_set;
+        bool cond = true;
+
+        {
+            pool_set myset;
+            long empty = Tracked::live; // the header's summary
+
+            for (int i = 0; i < 10; ++i)
+                myset.insert(9 - i);
+            cond = cond && myset.aggregate(2, 4).s == std::string(20, 'c') + std::string(20, 'd');
+            myset.clear();
+            cond = cond && Tracked::live == empty;
+            for (int i = 0; i < 10; ++i)
+                myset.insert(i);
+        }
+        cond = cond && Tracked::live == 0;
+        EQUAL(cond);
+    }
 }
 void testRetionalOperators()
 {
@@ -162,18 +162,12 @@ namespace ft {
 					* @param lhs, rhs Stack objects (to the left- and right-hand size of the operator, respectively).
 					* @return true if the condition holds, and false otherwise
 					*/
-					template <class V, class U>
-						friend bool operator== (const Stack<V, U>& lhs, const Stack<V, U>& rhs) {return (lhs._cntr == rhs._cntr);}
-					template <class V, class U>
-						friend bool operator!= (const Stack<V, U>& lhs, const Stack<V, U>& rhs) {return (lhs._cntr != rhs._cntr);}
-					template <class V, class U>
-						friend bool operator< (const Stack<V, U>& lhs, const Stack<V, U>& rhs) {return (lhs._cntr < rhs._cntr);}
-					template <class V, class U>
-						friend bool operator<= (const Stack<V, U>& lhs, const Stack<V, U>& rhs) {return (lhs._cntr <= rhs._cntr);}
-					template <class V, class U>
-						friend bool operator> (const Stack<V, U>& lhs, const Stack<V, U>& rhs) { return (lhs._cntr > rhs._cntr);}
-					template <class V, class U>
-						friend bool operator>= (const Stack<V, U>& lhs, const Stack<V, U>& rhs) {return (lhs._cntr >= rhs._cntr);}
+					friend bool operator== (const Stack& lhs, const Stack& rhs) {return (lhs._cntr == rhs._cntr);}
+					friend bool operator!= (const Stack& lhs, const Stack& rhs) {return (lhs._cntr != rhs._cntr);}
+					friend bool operator< (const Stack& lhs, const Stack& rhs) {return (lhs._cntr < rhs._cntr);}
+					friend bool operator<= (const Stack& lhs, const Stack& rhs) {return (lhs._cntr <= rhs._cntr);}
+					friend bool operator> (const Stack& lhs, const Stack& rhs) { return (lhs._cntr > rhs._cntr);}
+					friend bool operator>= (const Stack& lhs, const Stack& rhs) {return (lhs._cntr >= rhs._cntr);}
 			};
 
 			/* -------------------- Non-member function overload -------------------- */
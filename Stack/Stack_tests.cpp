@@ -13,6 +13,8 @@
 // you should include your path to this files
 #include "Stack.hpp"       // your stack path.
 #include "../Vector/Vector.hpp" // your Vector path.
+#include "../Vector/SmallVector.hpp"
+#include "../utils/mmap_allocator.hpp"
 #include "../utils/pair.hpp"  // path to ft::pair.
 
 #include <vector>
@@ -322,6 +324,87 @@ void	testRelationalOperators(void)
 	}
 }
 
+void	testSmallVectorContainer(void)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " small vector container "
+              << "] --------------------]\t\t\033[0m";
+	{
+		ft::Stack<std::string, ft::SmallVector<std::string, 8> > mystack;
+		std::stack<std::string>                                  stack;
+		bool                                                     cond = true;
+
+		for (int i = 0; i < 20; i++) {
+			mystack.push(std::string(i, 'a'));
+			stack.push(std::string(i, 'a'));
+		}
+		while (cond && !stack.empty()) {
+			cond = (mystack.top() == stack.top() && mystack.size() == stack.size());
+			mystack.pop();
+			stack.pop();
+		}
+		ft::Stack<int, ft::SmallVector<int, 4> > lhs, rhs;
+		for (int i = 0; i < 3; i++) {
+			lhs.push(i);
+			rhs.push(i);
+		}
+		cond = cond && mystack.empty() && (lhs == rhs);
+		rhs.push(1);
+		cond = cond && (lhs < rhs) && (lhs != rhs);
+		EQUAL(cond);
+	}
+}
+
+void	testMmapAllocatorContainer(void)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " mmap allocator container "
+              << "] --------------------]\t\t\033[0m";
+	{
+		ft::Stack<double, ft::Vector<double, ft::MmapAllocator<double> > > mystack;
+		std::stack<double>                                                 stack;
+		bool                                                               cond = true;
+
+		for (int i = 0; i < 500000; i++) {
+			mystack.push(i * 0.5);
+			stack.push(i * 0.5);
+		}
+		while (cond && !stack.empty()) {
+			cond = (mystack.top() == stack.top() && mystack.size() == stack.size());
+			mystack.pop();
+			stack.pop();
+		}
+		EQUAL(cond && mystack.empty());
+	}
+}
+
+void	testByteStackComparisons(void)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " uint8_t stack comparisons "
+              << "] --------------------]\t\t\033[0m";
+	{
+		ft::Stack<uint8_t>	lhs, rhs;
+		std::stack<uint8_t>	slhs, srhs;
+		bool				cond = true;
+
+		for (int i = 0; i < 300; i++) {
+			lhs.push(static_cast<uint8_t>(i * 7));
+			rhs.push(static_cast<uint8_t>(i * 7));
+			slhs.push(static_cast<uint8_t>(i * 7));
+			srhs.push(static_cast<uint8_t>(i * 7));
+		}
+		cond = (lhs == rhs && !(lhs < rhs) && lhs <= rhs);
+		rhs.pop();
+		srhs.pop();
+		rhs.push(200);
+		srhs.push(200);
+		cond = (cond && (lhs < rhs) == (slhs < srhs) && (lhs > rhs) == (slhs > srhs) && (lhs != rhs) == (slhs != srhs));
+		rhs.push(0);
+		srhs.push(0);
+		lhs.pop();
+		slhs.pop();
+		cond = (cond && (lhs < rhs) == (slhs < srhs) && (lhs >= rhs) == (slhs >= srhs));
+		EQUAL(cond);
+	}
+}
 
 void alarm_handler(int seg)
 {
@@ -346,5 +429,10 @@ int main()
     std::cout << YELLOW << "Testing relational operators;" << RESET << std::endl;
     TEST_CASE(testRelationalOperators);
 
+    std::cout << YELLOW << "Testing underlying containers;" << RESET << std::endl;
+    TEST_CASE(testSmallVectorContainer);
+    TEST_CASE(testMmapAllocatorContainer);
+    TEST_CASE(testByteStackComparisons);
+
 	return 0;
 }
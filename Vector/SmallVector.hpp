@@ -0,0 +1,425 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SmallVector.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/03 09:41:27 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/03 09:41:27 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+# include "random_access_iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "iterator_traits.hpp"
+# include "growth_policy.hpp"
+# include "vector_storage.hpp"
+# include "../utils/utils.hpp"
+# include <memory>
+# include <utility>
+# include <stdexcept>
+
+namespace ft {
+
+	/** @brief Vector with inline storage for the first N elements
+	 * A SmallVector behaves like a Vector, and exposes the same interface and iterators, but keeps it's first N
+	 * elements inside the object itself. The allocator is only used once the size grows past N, at which point the
+	 * elements are relocated to the heap like any vector reallocation.
+	 *
+	 * Moving or swapping a SmallVector whose elements are inline moves the elements one by one, since there is no
+	 * buffer to steal. All iterators are invalidated in that case.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam N Number of elements stored inline
+	 * @tparam Alloc Allocator used once the inline storage is exhausted
+	 * @tparam GrowthPolicy Growth policy used past the inline storage (see growth_policy.hpp)
+	 */
+	template<class T, size_t N, class Alloc = std::allocator<T>, class GrowthPolicy = ft::growth_double>
+	class SmallVector {
+	public:
+		typedef T                               					value_type;
+		typedef Alloc                           					allocator_type;
+		typedef GrowthPolicy										growth_policy;
+		typedef typename allocator_type::reference       			reference;
+		typedef typename allocator_type::const_reference 			const_reference;
+		typedef typename allocator_type::pointer             		pointer;
+		typedef typename allocator_type::const_pointer				const_pointer;
+		typedef typename ft::random_access_iterator<T>				iterator;
+		typedef typename ft::random_access_iterator<const T>		const_iterator;
+		typedef typename ft::reverse_iterator<iterator>				reverse_iterator;
+		typedef typename ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+		typedef ptrdiff_t											difference_type;
+		typedef size_t												size_type;
+
+		/**
+		 * Number of elements stored inline (the second template parameter)
+		 */
+		static const size_type	inline_capacity = N;
+
+	private:
+		pointer   		_container;
+		size_type		_size;
+		size_type		_capacity;
+		allocator_type	_alloc;
+		typename std::aligned_storage<sizeof(T) * (N ? N : 1), alignof(T)>::type	_buffer;
+
+		typedef ft::vector_storage<allocator_type>	_storage;
+
+		pointer		_inline() {
+			return (reinterpret_cast<pointer>(&_buffer));
+		}
+		bool		_isInline() const {
+			return (_container == reinterpret_cast<const_pointer>(&_buffer));
+		}
+
+		/** @brief Release the heap block, if any, and go back to the inline storage
+		 * The elements must have been destroyed or relocated beforehand.
+		 */
+		void	_release() {
+			if (!_isInline())
+				_alloc.deallocate(_container, _capacity);
+			_container = _inline();
+			_capacity = N;
+		}
+
+		void	_grow(size_type required) {
+			size_type	n = growth_policy::grow(_size, required, sizeof(value_type));
+
+			if (n < required || n > max_size())
+				n = (required > max_size()) ? required : max_size();
+			reserve(n);
+		}
+
+		/** @brief Take over the elements of x, which is left empty
+		 * Steals x's heap block when it has one, otherwise relocates it's inline elements.
+		 */
+		void	_steal(SmallVector& x) {
+			if (!x._isInline()) {
+				_container = x._container;
+				_capacity = x._capacity;
+				x._container = x._inline();
+				x._capacity = N;
+			} else
+				_relocate(_container, x._container, x._size);
+			_size = x._size;
+			x._size = 0;
+		}
+
+		void	_shiftRight(size_type pos, size_type n) {
+			_storage::shift_right(_alloc, _container, _size, pos, n);
+		}
+		void	_shiftLeft(size_type pos, size_type n) {
+			_storage::shift_left(_alloc, _container, _size, pos, n);
+			_size -= n;
+		}
+		void	_relocate(pointer dst, pointer src, size_type n) {
+			_storage::relocate(_alloc, dst, src, n);
+		}
+		void	_destroy(pointer first, pointer last) {
+			_storage::destroy(_alloc, first, last);
+		}
+
+	public:
+		// ------------------------ Construction ----------------------------- //
+
+		/** @brief Empty container constructor ( default constructor )
+		 * Constructs an empty container, using the inline storage.
+		 */
+		explicit SmallVector(const allocator_type& alloc = allocator_type()): _container(_inline()), _size(0), _capacity(N), _alloc(alloc) {
+			return ;
+		}
+
+		/** @brief Fill constructor
+		 * Constructs a container with n elements. Each element is a copy of val.
+		 */
+		explicit SmallVector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _container(_inline()), _size(0), _capacity(N), _alloc(alloc) {
+			assign(n, val);
+		}
+
+		/** @brief Range constructor
+		 * Constructs a container with as many elements as the range [first,last], in the same order.
+		 */
+		template <class InputIterator>
+			SmallVector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()): _container(_inline()), _size(0), _capacity(N), _alloc(alloc) {
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+
+		/** @brief Copy constructor
+		 * Construct a container with a copy of each of the elements in x, in the same order.
+		 */
+		SmallVector(const SmallVector& x): _container(_inline()), _size(0), _capacity(N), _alloc(x._alloc) {
+			*this = x;
+		}
+
+		/** @brief Move constructor
+		 * Takes over x's heap block if it has one, otherwise moves it's inline elements. x is left empty.
+		 */
+		SmallVector(SmallVector&& x) noexcept: _container(_inline()), _size(0), _capacity(N), _alloc(std::move(x._alloc)) {
+			_steal(x);
+		}
+
+		~SmallVector() {
+			_destroy(_container, _container + _size);
+			_release();
+		}
+
+		SmallVector&	operator= (const SmallVector& x) {
+			if (this == &x)
+				return (*this);
+			clear();
+			reserve(x._size);
+			_storage::copy(_alloc, _container, x._container, x._size);
+			_size = x._size;
+			return (*this);
+		}
+
+		SmallVector&	operator= (SmallVector&& x) noexcept {
+			if (this == &x)
+				return (*this);
+			clear();
+			_release();
+			_alloc = std::move(x._alloc);
+			_steal(x);
+			return (*this);
+		}
+
+		// --------------------------- Iterators ------------------------------ //
+
+		iterator 				begin() { return (iterator(_container)); }
+		const_iterator 			begin() const { return (const_iterator(_container)); }
+		iterator				end() { return (iterator(_container + _size)); }
+		const_iterator			end() const { return (const_iterator(_container + _size)); }
+		reverse_iterator		rbegin() { return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin() const { return (const_reverse_iterator(end())); }
+		reverse_iterator		rend() { return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend() const { return (const_reverse_iterator(begin())); }
+
+		// --------------------------- Capacity ------------------------------ //
+
+		size_type	size() const { return (_size); }
+		size_type	max_size() const { return (_alloc.max_size()); }
+		size_type	capacity() const { return (_capacity); }
+		bool		empty() const { return (_size == 0); }
+
+		/** Tell whether the elements are stored inline
+		 * @return true while the elements live inside the object, false once they spilled to the heap.
+		 */
+		bool		is_inline() const { return (_isInline()); }
+
+		void 		resize(size_type n, value_type val = value_type()) {
+			if (n <= _size) {
+				_destroy(_container + n, _container + _size);
+				_size = n;
+				return ;
+			}
+			if (n > _capacity)
+				reserve(n);
+			for (size_type i = _size; i < n; i++)
+				_alloc.construct(&_container[i], val);
+			_size = n;
+		}
+
+		/** Request a change in capacity
+		 * Past the inline capacity, moves the elements to a heap block holding at least n elements.
+		 */
+		void		reserve(size_type n) {
+			if (n > max_size())
+				throw std::length_error("ft::small_vector::reserve");
+			if (n <= _capacity)
+				return ;
+			pointer tmp = _alloc.allocate(n);
+			_relocate(tmp, _container, _size);
+			_release();
+			_container = tmp;
+			_capacity = n;
+		}
+
+		// ------------------------- Element access -------------------------- //
+
+		reference			operator[] (size_type n) { return (_container[n]); }
+		const_reference		operator[] (size_type n) const { return (_container[n]); }
+		reference			at (size_type n) {
+			if (n >= _size)
+				throw std::out_of_range("ft::small_vector::at");
+			return (_container[n]);
+		}
+		const_reference 	at (size_type n) const {
+			if (n >= _size)
+				throw std::out_of_range("ft::small_vector::at");
+			return (_container[n]);
+		}
+		reference			front() { return (_container[0]); }
+		const_reference		front() const { return (_container[0]); }
+		reference 			back() { return (_container[_size - 1]); }
+		const_reference		back() const { return (_container[_size - 1]); }
+
+		// -------------------------    Modifiers   -------------------------- //
+
+		template <class InputIterator>
+			void	assign (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()) {
+				clear();
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+		void 	assign (size_type n, const value_type& val) {
+			clear();
+			reserve(n);
+			for (size_type i = 0; i < n ; i++)
+				_alloc.construct(&_container[i], val);
+			_size = n;
+		}
+
+		void 	push_back (const value_type& val) { emplace_back(val); }
+		void 	push_back (value_type&& val) { emplace_back(std::move(val)); }
+
+		template <class... Args>
+		void 	emplace_back (Args&&... args) {
+			if (_size == _capacity) {
+				value_type	tmp(std::forward<Args>(args)...);
+
+				_grow(_size + 1);
+				_alloc.construct(&_container[_size], std::move(tmp));
+			} else
+				_alloc.construct(&_container[_size], std::forward<Args>(args)...);
+			_size++;
+		}
+
+		void 	pop_back() {
+			_alloc.destroy(&_container[_size - 1]);
+			_size--;
+		}
+
+		iterator	insert (iterator position, const value_type& val) { return (emplace(position, val)); }
+		iterator	insert (iterator position, value_type&& val) { return (emplace(position, std::move(val))); }
+
+		template <class... Args>
+		iterator	emplace (iterator position, Args&&... args) {
+			size_type	dis = position - begin();
+
+			if (dis == _size) {
+				emplace_back(std::forward<Args>(args)...);
+				return (begin() + dis);
+			}
+			value_type	tmp(std::forward<Args>(args)...);
+
+			if (_size + 1 > _capacity)
+				_grow(_size + 1);
+			_shiftRight(dis, 1);
+			_alloc.construct(&_container[dis], std::move(tmp));
+			_size++;
+			return (begin() + dis);
+		}
+
+		void 		insert (iterator position, size_type n, const value_type& val) {
+			size_type	dis = position - begin();
+
+			if (n == 0)
+				return ;
+			if (&val >= _container && &val < _container + _size) {
+				value_type	tmp(val);
+
+				insert(position, n, tmp);
+				return ;
+			}
+			if (_size + n > _capacity)
+				_grow(_size + n);
+			_shiftRight(dis, n);
+			for (size_type i = 0 ; i < n ; i++)
+				_alloc.construct(&_container[dis + i], val);
+			_size += n;
+		}
+
+		template <class InputIterator>
+			void	insert (iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()) {
+				SmallVector	tmp(first, last);
+				size_type	dis = position - begin();
+				size_type	n = tmp.size();
+
+				if (_size + n > _capacity)
+					_grow(_size + n);
+				_shiftRight(dis, n);
+				for (size_type i = 0; i < n ; i++)
+					_alloc.construct(&_container[dis + i], std::move(tmp[i]));
+				_size += n;
+			}
+
+		iterator	erase (iterator position) {
+			_shiftLeft(position - begin(), 1);
+			return (position);
+		}
+		iterator 	erase (iterator first, iterator last) {
+			if (first != last)
+				_shiftLeft(first - begin(), last - first);
+			return (first);
+		}
+
+		/** Swap content
+		 * Heap blocks are exchanged in constant time. When either side is inline the elements are moved instead,
+		 * so iterators to the inline elements are not carried over.
+		 */
+		void 	swap (SmallVector& x) {
+			if (this == &x)
+				return ;
+			if (!_isInline() && !x._isInline()) {
+				std::swap(_container, x._container);
+				std::swap(_size, x._size);
+				std::swap(_capacity, x._capacity);
+				std::swap(_alloc, x._alloc);
+				return ;
+			}
+			SmallVector	tmp(std::move(x));
+
+			x = std::move(*this);
+			*this = std::move(tmp);
+		}
+
+		void 	clear() {
+			_destroy(_container, _container + _size);
+			_size = 0;
+		}
+
+		allocator_type		get_allocator() const {
+			return (_alloc);
+		}
+	};
+
+	// ----------------- Non-member function overloads  ------------------ //
+
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool 	operator== (const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs) {
+			if (lhs.size() != rhs.size())
+				return (false);
+			return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool	operator!= (const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs) {
+			return (!(lhs == rhs));
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool 	operator< (const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs) {
+			return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool 	operator<= (const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs) {
+			return (!(rhs < lhs));
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool 	operator>	(const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs) {
+			return (rhs < lhs);
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+		bool 	operator>=	(const SmallVector<T, N, Alloc, GrowthPolicy>& lhs, const SmallVector<T, N, Alloc, GrowthPolicy>& rhs){
+			return (!(lhs < rhs));
+		}
+	template <class T, size_t N, class Alloc, class GrowthPolicy>
+	void 	swap (SmallVector<T, N, Alloc, GrowthPolicy>& x, SmallVector<T, N, Alloc, GrowthPolicy>& y) {
+		x.swap(y);
+	}
+}
+
+#endif
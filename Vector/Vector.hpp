@@ -16,12 +16,24 @@
 # include "random_access_iterator.hpp"
 # include "reverse_iterator.hpp"
 # include "iterator_traits.hpp"
+# include "growth_policy.hpp"
+# include "vector_storage.hpp"
 # include "../utils/utils.hpp"
 # include <iostream>
+# include <utility>
+# include <stdexcept>
+# include <algorithm>
 
 namespace ft {
+	/** @brief Default initialization tag
+	 * Selects the constructors that default initialize their elements instead of value initializing them, see
+	 * Vector::resize_default_init.
+	 */
+	struct default_init_t {};
+	static const default_init_t	default_init = default_init_t();
+
 
-	template<class T, class Alloc = std::allocator<T> >
+	template<class T, class Alloc = std::allocator<T>, class GrowthPolicy = ft::growth_double>
 	class Vector {
 	public:
 		/**
@@ -35,6 +47,12 @@ namespace ft {
 		 */
 		typedef Alloc                           			allocator_type;
 
+		/**
+		 * The third template parameter (GrowthPolicy)
+		 * @defaults to: growth_double
+		 */
+		typedef GrowthPolicy								growth_policy;
+
 		/**
 		 * allocator_type::reference
 		 * @for the default allocator: value_type&
@@ -102,6 +120,142 @@ namespace ft {
 		size_type		_capacity;
 		allocator_type	_alloc;
 
+		typedef ft::vector_storage<allocator_type>	_storage;
+
+		/** @brief Open a gap of n slots at pos
+		 * The gap [pos, pos + n) is left as raw storage and the size is not updated, the caller constructs the new
+		 * elements there (see vector_storage::shift_right).
+		 */
+		void	_shiftRight(size_type pos, size_type n) {
+			_storage::shift_right(_alloc, _container, _size, pos, n);
+		}
+
+		/** @brief Close the n slots starting at pos, and shrink the size accordingly
+		 */
+		void	_shiftLeft(size_type pos, size_type n) {
+			_storage::shift_left(_alloc, _container, _size, pos, n);
+			_size -= n;
+		}
+
+		/** @brief Grow the storage to hold at least required elements
+		 * The new capacity is chosen by the growth policy, and capped to max_size.
+		 */
+		void	_grow(size_type required) {
+			size_type	n = growth_policy::grow(_size, required, sizeof(value_type));
+
+			if (n < required || n > max_size())
+				n = (required > max_size()) ? required : max_size();
+			reserve(n);
+		}
+
+		/** @brief Move the elements to a block of n elements
+		 * When the elements are trivially copyable and the allocator can grow a block in place (has_reallocate), the
+		 * block is handed to the allocator's reallocate, which may move the pages instead of copying them.
+		 * Otherwise a new block is allocated, the elements relocated into it and the old block released.
+		 */
+		void	_reallocate(size_type n) {
+			_reallocate(n, ft::integral_constant<bool, ft::is_trivially_copyable<value_type>::value
+													&& ft::has_reallocate<allocator_type>::value>());
+		}
+		void	_reallocate(size_type n, ft::true_type) {
+			if (_container == nullptr)
+				_container = _alloc.allocate(n);
+			else
+				_container = _alloc.reallocate(_container, _capacity, n);
+			_capacity = n;
+		}
+		void	_reallocate(size_type n, ft::false_type) {
+			pointer tmp = _alloc.allocate(n);
+
+			_relocate(tmp, _container, _size);
+			if (_container != nullptr)
+				_alloc.deallocate(_container, _capacity);
+			_container = tmp;
+			_capacity = n;
+		}
+
+		void	_relocate(pointer dst, pointer src, size_type n) {
+			_storage::relocate(_alloc, dst, src, n);
+		}
+		void	_copy(pointer dst, const_pointer src, size_type n) {
+			_storage::copy(_alloc, dst, src, n);
+		}
+		void	_destroy(pointer first, pointer last) {
+			_storage::destroy(_alloc, first, last);
+		}
+
+		/** @brief Default initialize the elements in [first, last)
+		 * Nothing is written for trivially default constructible elements, the others are built with a placement
+		 * new without initializer (the allocator's construct would value initialize them).
+		 */
+		void	_defaultInit(pointer first, pointer last) {
+			_defaultInit(first, last, ft::is_trivially_default_constructible<value_type>());
+		}
+		void	_defaultInit(pointer, pointer, ft::true_type) {
+		}
+		void	_defaultInit(pointer first, pointer last, ft::false_type) {
+			for (; first != last; ++first)
+				::new (static_cast<void*>(first)) value_type;
+		}
+
+		/** @brief Number of elements in [first, last)
+		 * Random access ranges are measured with a subtraction, other forward ranges with one counting pass.
+		 */
+		template <class Iterator>
+		static size_type	_rangeLength(Iterator first, Iterator last, std::random_access_iterator_tag) {
+			return (static_cast<size_type>(last - first));
+		}
+		template <class Iterator>
+		static size_type	_rangeLength(Iterator first, Iterator last, std::forward_iterator_tag) {
+			size_type	n = 0;
+
+			for (; first != last; ++first)
+				n++;
+			return (n);
+		}
+
+		/** @brief Construct copies of [first, last) after the last element
+		 * Forward ranges are measured first and the storage reserved to the exact size once. Input ranges can only
+		 * be read once, so they are streamed in with the amortized growth of the policy.
+		 */
+		template <class InputIterator>
+		void	_rangeAppend(InputIterator first, InputIterator last, std::input_iterator_tag) {
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+		template <class ForwardIterator>
+		void	_rangeAppend(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+			size_type	n = _rangeLength(first, last, typename ft::iterator_traits<ForwardIterator>::iterator_category());
+
+			if (_size + n > _capacity)
+				reserve(_size + n);
+			for (; first != last; ++first, ++_size)
+				_alloc.construct(&_container[_size], *first);
+		}
+
+		/** @brief Insert copies of [first, last) at pos
+		 * Forward ranges are measured, the gap opened once and filled in place. Input ranges are appended, then
+		 * rotated into position, which keeps the insertion linear without knowing the length up front.
+		 */
+		template <class InputIterator>
+		void	_rangeInsert(size_type pos, InputIterator first, InputIterator last, std::input_iterator_tag) {
+			size_type	old_size = _size;
+
+			_rangeAppend(first, last, std::input_iterator_tag());
+			std::rotate(_container + pos, _container + old_size, _container + _size);
+		}
+		template <class ForwardIterator>
+		void	_rangeInsert(size_type pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+			size_type	n = _rangeLength(first, last, typename ft::iterator_traits<ForwardIterator>::iterator_category());
+
+			if (_size + n > _capacity)
+				_grow(_size + n);
+			_shiftRight(pos, n);
+			for (size_type i = 0; i < n ; i++, ++first)
+				_alloc.construct(&_container[pos + i], *first);
+			_size += n;
+		}
+
 
 	public:
 		/** Empty container constructor ( default constructor )
@@ -121,23 +275,29 @@ namespace ft {
 				_alloc.construct(_container + i, val);
 		}
 
+		/** Default initializing fill constructor
+		** @Constructs a container with n default initialized elements: for trivially default constructible types
+		** the storage is allocated but never written, the caller is expected to fill every slot.
+		** @param n Container size
+		** @param tag ft::default_init
+		** @param alloc Allocator object
+		 */
+		Vector(size_type n, ft::default_init_t, const allocator_type& alloc = allocator_type()): _container(nullptr), _size(0), _capacity(0), _alloc(alloc) {
+			resize_default_init(n);
+		}
+
 		/** Range constructor
 		** @Constructs a container with as many elements as the range [first,last], with each elements
 		** constructed from it's corresponding elements in that range, in the same order.
+		** Forward ranges are allocated exactly once, input ranges (single pass) grow as they are read.
 		** @param first InputIterator
 		** @param last InputIterator
 		** @param alloc Allocator_type
 		** @return
 		 */
 		template <class InputIterator>
-			Vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()): _alloc(alloc) {
-				_size = std::distance(first, last);
-				_capacity= _size;
-				_container = _alloc.allocate(_size);
-				for (int i = 0; first != last; first++) {
-					_alloc.construct(&_container[i], *first);
-					i++;
-				}
+			Vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()): _container(nullptr), _size(0), _capacity(0), _alloc(alloc) {
+				_rangeAppend(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 				return ;
 			}
 
@@ -151,6 +311,17 @@ namespace ft {
 			return ;
 		}
 
+		/** Move constructor
+		** @Constructs a container that acquires the elements of x by stealing it's buffer, x is left empty.
+		** @param x A vector object of the same type (i.e., with the same template parameters, T and Alloc)
+		 */
+		Vector(Vector &&x) noexcept: _container(x._container), _size(x._size), _capacity(x._capacity), _alloc(std::move(x._alloc)) {
+			x._container = nullptr;
+			x._size = 0;
+			x._capacity = 0;
+			return ;
+		}
+
 		// @The container keeps an internal copy of alloc, which is used to allocate storage throughout its lifetime.
 		// @The copy constructor creates a container that keeps and uses a copy of x's allocator
 
@@ -159,8 +330,7 @@ namespace ft {
 		 */
 		~Vector( void ) {
 			if (_container != nullptr) {
-				for (size_type i = 0; i < _size; i++)
-					_alloc.destroy(&_container[i]);
+				_destroy(_container, _container + _size);
 				_alloc.deallocate(_container, _capacity);
 			}
 			return ;
@@ -169,25 +339,51 @@ namespace ft {
 		/** Assign operator
 		 * Copies all the elements from x into the container.
 		 * The container preserves it's current allocator, which is used
-		 * to allocate storage in case of reallocation
+		 * to allocate storage in case of reallocation. The storage is kept when it can hold the elements of x,
+		 * otherwise the new block is allocated before the current elements are destroyed.
 		 *
 		 * @param x A vector object of the same type (i.e., with the same template parameters, T and Alloc)
 		 * @return *this
 		 */
 		Vector&			operator= (const Vector& x) {
-			if (_capacity < x._capacity || _container == nullptr)
-				reserve(x._capacity);
-			if (_container != nullptr) {
-				for (size_type i = 0; i < _size ; i++) {
-					_alloc.destroy(&_container[i]);
-				}
-			}
+			if (this == &x)
+				return (*this);
+			if (_capacity < x._size) {
+				pointer	block = _alloc.allocate(x._capacity);
+
+				_destroy(_container, _container + _size);
+				if (_container != nullptr)
+					_alloc.deallocate(_container, _capacity);
+				_container = block;
+				_capacity = x._capacity;
+			} else
+				_destroy(_container, _container + _size);
+			_size = 0;
+			_copy(_container, x._container, x._size);
+			_size = x._size;
+			return (*this);
+		}
+
+		/** Move assign operator
+		 * Releases the current elements and storage, then takes over the buffer of x in constant time.
+		 * x is left empty.
+		 *
+		 * @param x A vector object of the same type (i.e., with the same template parameters, T and Alloc)
+		 * @return *this
+		 */
+		Vector&			operator= (Vector&& x) noexcept {
+			if (this == &x)
+				return (*this);
+			clear();
+			if (_container != nullptr)
+				_alloc.deallocate(_container, _capacity);
+			_container = x._container;
 			_size = x._size;
-			_alloc = x._alloc;
 			_capacity = x._capacity;
-			for (size_type i = 0; i < _size; i++) {
-				_alloc.construct(_container + i, x._container[i]);
-			}
+			_alloc = std::move(x._alloc);
+			x._container = nullptr;
+			x._size = 0;
+			x._capacity = 0;
 			return (*this);
 		}
 
@@ -306,8 +502,7 @@ namespace ft {
 		 */
 		void 		resize(size_type n, value_type val = value_type()) {
 			if (n <= _size) {
-				for (size_type i = n + 1; i < _size ; i++)
-					_alloc.destroy(&_container[i]);
+				_destroy(_container + n, _container + _size);
 				_size = n;
 			} else {
 				if (n > _capacity)
@@ -319,6 +514,37 @@ namespace ft {
 			}
 		}
 
+		/** Change size, default initializing new elements
+		 * Same as resize, except that the added elements are default initialized instead of copied from a value:
+		 * trivially default constructible elements are left with indeterminate values, which saves a pass over the
+		 * memory when every slot is about to be overwritten (read(), a decoder ...).
+		 *
+		 * @param n New container size, expressed in number of elements.
+		 */
+		void		resize_default_init(size_type n) {
+			if (n <= _size) {
+				_destroy(_container + n, _container + _size);
+				_size = n;
+				return ;
+			}
+			if (n > _capacity)
+				reserve(n);
+			_defaultInit(_container + _size, _container + n);
+			_size = n;
+		}
+
+		/** Change size, leaving new elements uninitialized
+		 * resize_default_init restricted to trivially default constructible elements, for which it only moves the
+		 * end of the container: the memory of the added elements is not touched at all.
+		 *
+		 * @param n New container size, expressed in number of elements.
+		 */
+		void		resize_uninitialized(size_type n) {
+			static_assert(ft::is_trivially_default_constructible<value_type>::value,
+				"ft::Vector::resize_uninitialized requires a trivially default constructible value_type");
+			resize_default_init(n);
+		}
+
 
 		/** Return size of allocated storage capacity
 		 * Returns the size of the storage space currently allocated for the vector, expressed in terms of elements.
@@ -365,17 +591,10 @@ namespace ft {
 		 * @return none
 		 */
 		void		reserve(size_type n) {
-			if (n > _capacity) {
-				pointer tmp = _alloc.allocate(n);
-				for (size_type i = 0; i < _size ; i++) {
-					_alloc.construct(&tmp[i], _container[i]);
-					_alloc.destroy(&_container[i]);
-				}
-				if (_capacity != 0)
-					_alloc.deallocate(_container, _capacity);
-				_container = tmp;
-				_capacity = n;
-			}
+			if (n > max_size())
+				throw std::length_error("ft::vector::reserve");
+			if (n > _capacity)
+				_reallocate(n);
 		}
 
 
@@ -501,17 +720,8 @@ namespace ft {
 		 */
 		template <class InputIterator>
 				void	assign (InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()) {
-					size_type dis = std::distance(first, last);
-					size_type position = 0;
-					if (dis > _size)
-						reserve(dis);
-					for (position = 0; first != last; first++ ) {
-						_alloc.construct(&_container[position++], *first);
-					}
-					for (; position < _size; position++) {
-						_alloc.destroy(&_container[position]);
-					}
-					_size = dis;
+					clear();
+					_rangeAppend(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 				}
 
 
@@ -559,11 +769,34 @@ namespace ft {
 		 * @return none
 		 */
 		void 			push_back (const value_type& val) {
-			if (_size == 0)
-				reserve(1);
-			if (_size + 1 > _capacity)
-				reserve(_capacity * 2);
-			_alloc.construct(&_container[_size], val);
+			emplace_back(val);
+		}
+		void 			push_back (value_type&& val) {
+			emplace_back(std::move(val));
+		}
+
+
+
+
+		/** Construct and insert element at the end
+		 * Inserts a new element at the end of the vector, right after it's current last element. This new element is
+		 * constructed in place using args as the arguments for it's constructor.
+		 *
+		 * When the storage has to grow, the element is first built aside so that args may safely refer to elements of
+		 * the vector itself, then moved into the new storage.
+		 *
+		 * @param args Arguments forwarded to construct the new element.
+		 * @return none
+		 */
+		template <class... Args>
+		void 			emplace_back (Args&&... args) {
+			if (_size == _capacity) {
+				value_type	tmp(std::forward<Args>(args)...);
+
+				_grow(_size + 1);
+				_alloc.construct(&_container[_size], std::move(tmp));
+			} else
+				_alloc.construct(&_container[_size], std::forward<Args>(args)...);
 			_size++;
 		}
 
@@ -612,23 +845,41 @@ namespace ft {
 		 * exceptions on failure (for the default allocator, bad_alloc is thrown if the allocation request does not succeed).
 		 */
 		iterator	insert	(iterator position, const value_type& val) {
-			size_type dis = std::distance(begin(), position);
-
-			if (_size == 0)
-				reserve(1);
-			else if (_size + 1 > _capacity)
-				reserve(_capacity * 2);
-			if (_size == 0)
-				_alloc.construct(&_container[_size++], val);
-			else {
-				value_type tmp = _container[dis];
-				_alloc.construct(&_container[dis], val);
-				for (size_type i = _size - 1 ; i > dis ; i--) {
-					_alloc.construct(&_container[i + 1], _container[i]);
-				}
-				_alloc.construct(&_container[dis + 1], tmp);
-				_size++;
+			return (emplace(position, val));
+		}
+		iterator	insert	(iterator position, value_type&& val) {
+			return (emplace(position, std::move(val)));
+		}
+
+
+
+
+		/** Construct and insert element
+		 * The container is extended by inserting a new element at position. This new element is constructed in place
+		 * using args as the arguments for it's construction.
+		 *
+		 * The elements after position are moved one slot towards the end, which is generally an inefficient operation
+		 * compared to emplace_back.
+		 *
+		 * @param position Position in the container where the new element is inserted.
+		 * @param args Arguments forwarded to construct the new element.
+		 * @return An iterator that points to the newly emplaced element.
+		 */
+		template <class... Args>
+		iterator	emplace	(iterator position, Args&&... args) {
+			size_type	dis = std::distance(begin(), position);
+
+			if (dis == _size) {
+				emplace_back(std::forward<Args>(args)...);
+				return (begin() + dis);
 			}
+			value_type	tmp(std::forward<Args>(args)...);
+
+			if (_size + 1 > _capacity)
+				_grow(_size + 1);
+			_shiftRight(dis, 1);
+			_alloc.construct(&_container[dis], std::move(tmp));
+			_size++;
 			return (begin() + dis);
 		}
 
@@ -663,23 +914,20 @@ namespace ft {
 		void 		insert	(iterator position, size_type n, const value_type& val) {
 			size_type	InsertBegin = std::distance(begin(), position);
 
-			if (_size + n > _capacity) {
-				if (n > _size)
-					reserve(_size + n);
-				else
-					reserve(_capacity * 2);
+			if (n == 0)
+				return ;
+			if (&val >= _container && &val < _container + _size) {
+				value_type	tmp(val);
+
+				insert(position, n, tmp);
+				return ;
 			}
-			if (_size == 0) {
-				for (size_type i = 0; i < n ; i++) {
-					_alloc.construct(&_container[i], val);
-				}
-			} else {// Insert near the end
-				for (size_type i =  _size - 1 ; i >= InsertBegin; i--) {
-					_alloc.construct(&_container[i + n], _container[i]);
-				}
-				for (size_type i = 0 ; i < n ; i++) {
-					_alloc.construct(&_container[InsertBegin + i], val);
-				}
+
+			if (_size + n > _capacity)
+				_grow(_size + n);
+			_shiftRight(InsertBegin, n);
+			for (size_type i = 0 ; i < n ; i++) {
+				_alloc.construct(&_container[InsertBegin + i], val);
 			}
 			_size = _size + n;
 		}
@@ -714,31 +962,7 @@ namespace ft {
 		 */
 		template <class InputIterator>
 				void		insert (iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()) {
-					// TO-DO: Insert values from InputIterator first to last into container.
-					size_type	InsertBegin = std::distance(begin(), position);
-					size_type	InsertEnd = std::distance(position, end());
-					size_type	n = std::distance(first, last);
-
-
-					if (_size + n > _capacity) {
-						if (n > _size)
-							reserve(_size + n);
-						else
-							reserve(_capacity * 2);
-					}
-					if (_size == 0) {
-						for (size_type i = 0; i < n ; i++, ++first) {
-							_alloc.construct(&_container[i], *first);
-						}
-					} else  {// Insert near the end
-						for (size_type i =  _size ; i >= InsertEnd ; i--) {
-							_alloc.construct(&_container[i + n], _container[i]);
-						}
-						for (size_type i = 0; i < n ; i++ , ++first) {
-							_alloc.construct(&_container[InsertBegin + i], *first);
-						}
-					}
-					_size = _size + n;
+					_rangeInsert(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 				}
 
 		/** Erase elements
@@ -757,23 +981,15 @@ namespace ft {
 		 * function call. This is the container end if the operation erased the last element in the sequence.
 		 */
 		iterator		erase (iterator position) {
-			for (size_type i = std::distance(begin(), position); i < _size - 1 ; i++ ) {
-				_alloc.construct(&_container[i], _container[i + 1]);
-			}
-			_alloc.destroy(&_container[_size - 1]);
-			_size--;
+			_shiftLeft(std::distance(begin(), position), 1);
 			return (position);
 		}
 		iterator 		erase (iterator first, iterator last) {
-			// TO-DO: Destroy elements from first to last.
 			size_type EraseDistance = std::distance(first, last);
 			size_type EraseBegin = std::distance(begin(), first);
 
-			for (size_type i = 0; i < EraseDistance ; i++ ) {
-				_alloc.construct(&_container[EraseBegin + i], _container[--_size]);
-			}
-			for (size_type i = 0 ; i > EraseDistance ; i++)
-				_alloc.destroy(&_container[EraseBegin + i]);
+			if (EraseDistance != 0)
+				_shiftLeft(EraseBegin, EraseDistance);
 			return (first);
 		}
 
@@ -811,9 +1027,7 @@ namespace ft {
 		 * @return none
 		 */
 		void 			clear() {
-			for (size_type i = 0; i < _size; i++) {
-				_alloc.destroy(&_container[i]);
-			}
+			_destroy(_container, _container + _size);
 			_size = 0;
 		}
 
@@ -860,32 +1074,32 @@ namespace ft {
 	 * @param rhs
 	 * @return true if the condition holds, and false otherwise.
 	 */
-	template <class T, class Alloc>
-		bool 	operator== (const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs) {
+	template <class T, class Alloc, class GrowthPolicy>
+		bool 	operator== (const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs) {
 			if (lhs.size() != rhs.size())
             	return (lhs.size() == rhs.size());
-        	return (std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+        	return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
-	template <class T, class Alloc>
-		bool	operator!= (const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs) {
+	template <class T, class Alloc, class GrowthPolicy>
+		bool	operator!= (const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs) {
 			return (!(lhs == rhs));
 		}
-	template <class T, class Alloc>
-		bool 	operator< (const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs) {
+	template <class T, class Alloc, class GrowthPolicy>
+		bool 	operator< (const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs) {
 			return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 		}
-	template <class T, class Alloc>
-		bool 	operator<= (const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs) {
+	template <class T, class Alloc, class GrowthPolicy>
+		bool 	operator<= (const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs) {
 			if (lhs  < rhs || lhs == rhs)
             	return (true);
         	return (false);
 		}
-	template <class T, class Alloc>
-		bool 	operator>	(const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs) {
+	template <class T, class Alloc, class GrowthPolicy>
+		bool 	operator>	(const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs) {
 			return (!(lhs <= rhs));
 		}
-	template <class T, class Alloc>
-		bool 	operator>=	(const Vector<T, Alloc>& lhs, const Vector<T,Alloc>& rhs){
+	template <class T, class Alloc, class GrowthPolicy>
+		bool 	operator>=	(const Vector<T, Alloc, GrowthPolicy>& lhs, const Vector<T, Alloc, GrowthPolicy>& rhs){
 			return (!(lhs < rhs));
 		}
 
@@ -909,8 +1123,8 @@ namespace ft {
 	 * @param x, y vector containers of the same type (i.e, having both the same template parameters, T and Alloc).
 	 * @return none
 	 */
-	template <class T, class Alloc>
-	void 	swap (Vector<T,Alloc>& x, Vector<T,Alloc>& y) {
+	template <class T, class Alloc, class GrowthPolicy>
+	void 	swap (Vector<T, Alloc, GrowthPolicy>& x, Vector<T, Alloc, GrowthPolicy>& y) {
 		x.swap(y);
 	}
 }
@@ -0,0 +1,193 @@
+/* ************************************************************************************************ */
+/*                                                                                                  */
+/*   Vector_bench.cpp                                                                               */
+/*                                                                                                  */
+/*   Compares the growth policies and allocators of ft::Vector on a bulk push_back load: throughput */
+/*   and peak RSS; then the allocators on random reads over the filled vector: time and dTLB load   */
+/*   misses, read through perf_event_open when the kernel lets us (n/a otherwise), and the memory   */
+/*   backed by transparent huge pages, for a vector reserved up front and one grown by push_back.   */
+/*   Every configuration runs in it's own child process so the peak RSS of one run does not leak */
+/*   into the next one.                                                                             */
+/*                                                                                                  */
+/*   usage: ./Vector_bench [elements]                                                               */
+/*                                                                                                  */
+/* ************************************************************************************************ */
+#include <vector>
+# include <iostream>
+# include <iomanip>
+# include <cstdlib>
+# include <cstring>
+# include <fstream>
+# include <string>
+# include <unistd.h>
+# include <sys/time.h>
+# include <sys/resource.h>
+# include <sys/wait.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+# include "../Vector/Vector.hpp"
+# include "../utils/mmap_allocator.hpp"
+
+# define DEFAULT_ELEMENTS 50000000
+
+double get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    return ((time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3));
+}
+
+long    peak_rss_kb(void)
+{
+    struct rusage   usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_maxrss);
+}
+
+/*
+ * Opens a counter of the dTLB load misses of the calling process, returns -1 when perf events are not available
+ */
+int     open_dtlb_counter(void)
+{
+    struct perf_event_attr  attr;
+
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0)));
+}
+
+/*
+ * Anonymous memory of the calling process backed by transparent huge pages, in kB (-1 when unknown)
+ */
+long    huge_pages_kb(void)
+{
+    std::ifstream   smaps("/proc/self/smaps_rollup");
+    std::string     field;
+    long            kb;
+
+    while (smaps >> field)
+        if (field == "AnonHugePages:" && smaps >> kb)
+            return (kb);
+    return (-1);
+}
+
+template <class Container>
+void    random_access_load(const char *name, size_t elements, size_t reads, bool reserve = true)
+{
+    pid_t   pid = fork();
+
+    if (pid != 0) {
+        waitpid(pid, NULL, 0);
+        return ;
+    }
+    Container   v;
+
+    if (reserve)
+        v.reserve(elements);
+    for (size_t i = 0; i < elements; ++i)
+        v.push_back(static_cast<double>(i));
+
+    int         counter = open_dtlb_counter();
+    size_t      index = 1;
+    double      sum = 0;
+    long long   misses = 0;
+
+    if (counter != -1) {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    double      start = get_time();
+    for (size_t i = 0; i < reads; ++i) {
+        index = index * 6364136223846793005ULL + 1442695040888963407ULL;
+        sum += v[(index >> 17) % elements];
+    }
+    double      end = get_time();
+    if (counter != -1) {
+        ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counter, &misses, sizeof(misses)) != sizeof(misses))
+            counter = -1;
+    }
+
+    std::cout << std::setw(28) << std::left << name
+              << std::setw(14) << std::right << std::fixed << std::setprecision(1) << (end - start)
+              << std::setw(16) << std::setprecision(1) << (reads / ((end - start) * 1e3));
+    if (counter != -1)
+        std::cout << std::setw(16) << misses << std::setw(12) << std::setprecision(3) << (misses / static_cast<double>(reads));
+    else
+        std::cout << std::setw(16) << "n/a" << std::setw(12) << "n/a";
+    long        huge_kb = huge_pages_kb();
+
+    std::cout << std::setw(12) << (huge_kb < 0 ? -1 : huge_kb / 1024)
+              << std::setw(14) << static_cast<long long>(sum) % 10 << std::endl;
+    std::exit(0);
+}
+
+template <class Container>
+void    push_back_load(const char *name, size_t elements)
+{
+    pid_t   pid = fork();
+
+    if (pid != 0) {
+        waitpid(pid, NULL, 0);
+        return ;
+    }
+    long        base_rss = peak_rss_kb();
+    double      start = get_time();
+    Container   v;
+
+    for (size_t i = 0; i < elements; ++i)
+        v.push_back(static_cast<double>(i));
+    double      end = get_time();
+    long        rss = peak_rss_kb() - base_rss;
+    double      payload = elements * sizeof(double) / 1024.0;
+
+    std::cout << std::setw(28) << std::left << name
+              << std::setw(14) << std::right << std::fixed << std::setprecision(1) << (end - start)
+              << std::setw(16) << std::setprecision(1) << (elements / ((end - start) * 1e3))
+              << std::setw(16) << rss / 1024
+              << std::setw(12) << std::setprecision(2) << (rss / payload)
+              << std::setw(14) << v.capacity() << std::endl;
+    std::exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    size_t  elements = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : DEFAULT_ELEMENTS;
+
+    std::cout << "\033[1;36mpush_back of " << elements << " doubles\033[0m\n\n";
+    std::cout << std::setw(28) << std::left << "container"
+              << std::setw(14) << std::right << "time (ms)"
+              << std::setw(16) << "Mpush/s"
+              << std::setw(16) << "peak RSS (MB)"
+              << std::setw(12) << "RSS/data"
+              << std::setw(14) << "capacity" << std::endl;
+    push_back_load<std::vector<double> >("std::vector", elements);
+    push_back_load<ft::Vector<double> >("ft::Vector growth_double", elements);
+    push_back_load<ft::Vector<double, std::allocator<double>, ft::growth_half> >("ft::Vector growth_half", elements);
+    push_back_load<ft::Vector<double, std::allocator<double>, ft::growth_size_class> >("ft::Vector growth_size_class", elements);
+    push_back_load<ft::Vector<double, ft::MmapAllocator<double> > >("ft::Vector MmapAllocator", elements);
+
+    size_t  reads = elements / 2;
+
+    std::cout << "\n\033[1;36m" << reads << " random reads over " << elements << " doubles\033[0m\n\n";
+    std::cout << std::setw(28) << std::left << "container"
+              << std::setw(14) << std::right << "time (ms)"
+              << std::setw(16) << "Mread/s"
+              << std::setw(16) << "dTLB misses"
+              << std::setw(12) << "per read"
+              << std::setw(12) << "THP (MB)"
+              << std::setw(14) << "checksum" << std::endl;
+    random_access_load<std::vector<double> >("std::vector", elements, reads);
+    random_access_load<ft::Vector<double> >("ft::Vector std::allocator", elements, reads);
+    random_access_load<ft::Vector<double, ft::MmapAllocator<double> > >("ft::Vector MmapAllocator", elements, reads);
+    random_access_load<ft::Vector<double, ft::MmapAllocator<double> > >("  grown (mremap)", elements, reads, false);
+    return (0);
+}
@@ -0,0 +1,168 @@
+/* ************************************************************************************************ */
+/*                                                                                                  */
+/*   Vector_simd_bench.cpp                                                                          */
+/*                                                                                                  */
+/*   Compares the vectorized ft::find, ft::count, ft::min_element and ft::sum with the per-element  */
+/*   loop through ft::Vector's iterators, on int32_t, uint64_t and float vectors.                   */
+/*   Build it twice to see both kernels: -O2 alone uses SSE2, -O2 -mavx2 the AVX2 ones.             */
+/*                                                                                                  */
+/*   usage: ./Vector_simd_bench [elements] [rounds]                                                 */
+/*                                                                                                  */
+/* ************************************************************************************************ */
+# include <iostream>
+# include <iomanip>
+# include <cstdlib>
+# include <stdint.h>
+# include <sys/time.h>
+# include "../Vector/Vector.hpp"
+# include "../utils/algorithm.hpp"
+
+# define DEFAULT_ELEMENTS 4000000
+# define DEFAULT_ROUNDS 50
+
+double get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    return ((time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3));
+}
+
+/*
+ * Keeps the compiler from dropping the loops whose results are never used
+ */
+template <class T>
+void    keep(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+template <class T>
+typename ft::Vector<T>::iterator scalar_find(ft::Vector<T>& v, T value)
+{
+    typename ft::Vector<T>::iterator it = v.begin();
+
+    for (; it != v.end(); ++it)
+        if (*it == value)
+            break ;
+    return (it);
+}
+
+template <class T>
+long    scalar_count(ft::Vector<T>& v, T value)
+{
+    long    n = 0;
+
+    for (typename ft::Vector<T>::iterator it = v.begin(); it != v.end(); ++it)
+        if (*it == value)
+            n++;
+    return (n);
+}
+
+template <class T>
+typename ft::Vector<T>::iterator scalar_min(ft::Vector<T>& v)
+{
+    typename ft::Vector<T>::iterator best = v.begin();
+
+    for (typename ft::Vector<T>::iterator it = v.begin(); it != v.end(); ++it)
+        if (*it < *best)
+            best = it;
+    return (best);
+}
+
+template <class T>
+T       scalar_sum(ft::Vector<T>& v)
+{
+    T   result = T();
+
+    for (typename ft::Vector<T>::iterator it = v.begin(); it != v.end(); ++it)
+        result += *it;
+    return (result);
+}
+
+void    report(const char *type, const char *algorithm, double scalar, double simd, size_t bytes)
+{
+    std::cout << std::setw(10) << std::left << type
+              << std::setw(14) << algorithm
+              << std::setw(14) << std::right << std::fixed << std::setprecision(2) << scalar
+              << std::setw(14) << simd
+              << std::setw(12) << std::setprecision(1) << (bytes / (simd * 1e6))
+              << std::setw(10) << std::setprecision(2) << (scalar / simd) << "x" << std::endl;
+}
+
+template <class T>
+void    bench(const char *type, size_t elements, int rounds)
+{
+    ft::Vector<T>   v;
+    T               absent = static_cast<T>(1000);
+    double          start, scalar, simd;
+
+    for (size_t i = 0; i < elements; ++i)
+        v.push_back(static_cast<T>((i * 7) % 997));
+    v[elements / 2] = static_cast<T>(-1) < static_cast<T>(0) ? static_cast<T>(-5) : static_cast<T>(0);
+
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(scalar_find(v, absent));
+    scalar = (get_time() - start) / rounds;
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(ft::find(v.begin(), v.end(), absent));
+    simd = (get_time() - start) / rounds;
+    report(type, "find", scalar, simd, elements * sizeof(T));
+
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(scalar_count(v, static_cast<T>(3)));
+    scalar = (get_time() - start) / rounds;
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(ft::count(v.begin(), v.end(), static_cast<T>(3)));
+    simd = (get_time() - start) / rounds;
+    report(type, "count", scalar, simd, elements * sizeof(T));
+
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(scalar_min(v));
+    scalar = (get_time() - start) / rounds;
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(ft::min_element(v.begin(), v.end()));
+    simd = (get_time() - start) / rounds;
+    report(type, "min_element", scalar, simd, elements * sizeof(T));
+
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(scalar_sum(v));
+    scalar = (get_time() - start) / rounds;
+    start = get_time();
+    for (int r = 0; r < rounds; ++r)
+        keep(ft::sum(v.begin(), v.end()));
+    simd = (get_time() - start) / rounds;
+    report(type, "sum", scalar, simd, elements * sizeof(T));
+}
+
+int main(int argc, char **argv)
+{
+    size_t  elements = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : DEFAULT_ELEMENTS;
+    int     rounds = (argc > 2) ? std::atoi(argv[2]) : DEFAULT_ROUNDS;
+
+# if defined(FT_SIMD_AVX2)
+    std::cout << "\033[1;36mAVX2 kernels, ";
+# elif defined(FT_SIMD_SSE2)
+    std::cout << "\033[1;36mSSE2 kernels, ";
+# else
+    std::cout << "\033[1;36mno SIMD kernels, ";
+# endif
+    std::cout << elements << " elements, " << rounds << " rounds\033[0m\n\n";
+    std::cout << std::setw(10) << std::left << "type"
+              << std::setw(14) << "algorithm"
+              << std::setw(14) << std::right << "scalar (ms)"
+              << std::setw(14) << "simd (ms)"
+              << std::setw(12) << "simd GB/s"
+              << std::setw(11) << "speedup" << std::endl;
+    bench<int32_t>("int32_t", elements, rounds);
+    bench<uint64_t>("uint64_t", elements, rounds);
+    bench<float>("float", elements, rounds);
+    return (0);
+}
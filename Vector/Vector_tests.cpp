@@ -2,12 +2,20 @@
 #include <vector>
 # include <iostream>
 # include <iterator>
+# include <list>
+# include <sstream>
+# include <numeric>
+# include <algorithm>
+# include <stdint.h>
 # include <ctime>
 # include <iomanip>
 # include <unistd.h>
 # include <signal.h>
 # include <sys/time.h>
 # include "../Vector/Vector.hpp"
+# include "../Vector/SmallVector.hpp"
+# include "../utils/mmap_allocator.hpp"
+# include "../utils/algorithm.hpp"
 
 
 # define BLUE "\e[0;34m"
@@ -3198,9 +3206,537 @@ void vector_tests(void)
         /*--------------------------------------------------------------------------------------------*/
         EQUAL(cond);
     }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " move constructor " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>    v(20, "string");
+        std::vector<std::string>    v1(std::move(v));
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<std::string>     ft_v(20, "string");
+        std::string                 *data = &ft_v[0];
+        ft::Vector<std::string>     ft_v1(std::move(ft_v));
+        std::string s1, ft_s1;
+
+        for (size_t i = 0; i < v1.size(); ++i)
+            s1 += v1[i];
+        for (size_t i = 0; i < ft_v1.size(); ++i)
+            ft_s1 += ft_v1[i];
+        EQUAL(s1 == ft_s1 && v1.size() == ft_v1.size() && ft_v.size() == 0 && ft_v.capacity() == 0 && &ft_v1[0] == data);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " move = operator " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>    v(20, "string");
+        std::vector<std::string>    v1(5, "other");
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<std::string>     ft_v(20, "string");
+        ft::Vector<std::string>     ft_v1(5, "other");
+        std::string                 *data = &ft_v[0];
+        std::string s1, ft_s1;
+
+        v1 = std::move(v);
+        ft_v1 = std::move(ft_v);
+        for (size_t i = 0; i < v1.size(); ++i)
+            s1 += v1[i];
+        for (size_t i = 0; i < ft_v1.size(); ++i)
+            ft_s1 += ft_v1[i];
+        EQUAL(s1 == ft_s1 && v1.size() == ft_v1.size() && ft_v.size() == 0 && &ft_v1[0] == data);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push_back method (rvalue) " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>    v;
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<std::string>     ft_v;
+        std::string s1, ft_s1;
+        std::string moved(100, 'x');
+
+        for (int i = 0; i < 50; ++i) {
+            v.push_back(std::string(i, 'a'));
+            ft_v.push_back(std::string(i, 'a'));
+        }
+        ft_v.push_back(std::move(moved));
+        v.push_back(std::string(100, 'x'));
+        for (size_t i = 0; i < v.size(); ++i)
+            s1 += v[i];
+        for (size_t i = 0; i < ft_v.size(); ++i)
+            ft_s1 += ft_v[i];
+        EQUAL(s1 == ft_s1 && v.size() == ft_v.size() && v.capacity() == ft_v.capacity() && moved.empty());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " emplace_back method " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>    v;
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<std::string>     ft_v;
+        std::string s1, ft_s1;
+
+        for (int i = 0; i < 50; ++i) {
+            v.emplace_back(i, 'a' + i % 26);
+            ft_v.emplace_back(i, 'a' + i % 26);
+        }
+        /* the argument refers to an element of the vector itself while it reallocates */
+        while (ft_v.size() != ft_v.capacity()) {
+            v.emplace_back("pad");
+            ft_v.emplace_back("pad");
+        }
+        v.emplace_back(v[3]);
+        ft_v.emplace_back(ft_v[3]);
+        for (size_t i = 0; i < v.size(); ++i)
+            s1 += v[i];
+        for (size_t i = 0; i < ft_v.size(); ++i)
+            ft_s1 += ft_v[i];
+        EQUAL(s1 == ft_s1 && v.size() == ft_v.size());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " emplace method " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>    v(10, "string");
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<std::string>     ft_v(10, "string");
+        std::string s1, ft_s1;
+        bool        cond;
+
+        std::vector<std::string>::iterator it = v.emplace(v.begin() + 3, 5, 'z');
+        ft::Vector<std::string>::iterator ft_it = ft_v.emplace(ft_v.begin() + 3, 5, 'z');
+        cond = (*it == *ft_it && (ft_it - ft_v.begin()) == 3);
+        v.emplace(v.begin(), v[5]);
+        ft_v.emplace(ft_v.begin(), ft_v[5]);
+        v.emplace(v.end(), "last");
+        ft_v.emplace(ft_v.end(), "last");
+        ft_v.insert(ft_v.begin() + 1, std::string("moved"));
+        v.insert(v.begin() + 1, std::string("moved"));
+        for (size_t i = 0; i < v.size(); ++i)
+            s1 += v[i];
+        for (size_t i = 0; i < ft_v.size(); ++i)
+            ft_s1 += ft_v[i];
+        EQUAL(cond && s1 == ft_s1 && v.size() == ft_v.size());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " trivially copyable elements " << "] --------------------]\t\t\033[0m";
+    {
+        struct point { int x; double y; };
+        /*------------------ std::vectors ---------------------*/
+        std::vector<point>          v;
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<point>           ft_v;
+        bool                        cond = true;
+
+        for (int i = 0; i < 1000; ++i) {
+            point p = {i, i * 0.5};
+            v.push_back(p);
+            ft_v.push_back(p);
+        }
+        for (int i = 0; i < 100; ++i) {
+            point p = {-i, -i * 0.5};
+            v.insert(v.begin() + i * 7, p);
+            ft_v.insert(ft_v.begin() + i * 7, p);
+        }
+        v.insert(v.begin() + 3, 50, v[0]);
+        ft_v.insert(ft_v.begin() + 3, 50, ft_v[0]);
+        v.erase(v.begin() + 10, v.begin() + 300);
+        ft_v.erase(ft_v.begin() + 10, ft_v.begin() + 300);
+        v.erase(v.begin());
+        ft_v.erase(ft_v.begin());
+        ft::Vector<point>   ft_copy;
+        ft_copy = ft_v;
+        cond = (v.size() == ft_v.size() && ft_copy.size() == ft_v.size());
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i].x == ft_v[i].x && v[i].y == ft_v[i].y && ft_copy[i].x == ft_v[i].x);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " growth policies " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<int>                                                v;
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<int>                                                 ft_v;
+        ft::Vector<int, std::allocator<int>, ft::growth_half>           ft_half;
+        ft::Vector<int, std::allocator<int>, ft::growth_size_class>     ft_class;
+        bool                                                            cond = true;
+
+        for (int i = 0; i < 10000; ++i) {
+            size_t  half_cap = ft_half.capacity();
+            size_t  class_cap = ft_class.capacity();
+
+            v.push_back(i);
+            ft_v.push_back(i);
+            ft_half.push_back(i);
+            ft_class.push_back(i);
+            if (half_cap != ft_half.capacity())
+                cond = (cond && (half_cap < 2 || ft_half.capacity() == half_cap + half_cap / 2));
+            if (class_cap != ft_class.capacity())
+                cond = (cond && ft_class.capacity() >= class_cap + class_cap / 2
+                        && ft::growth_size_class::round(ft_class.capacity() * sizeof(int)) == ft_class.capacity() * sizeof(int));
+        }
+        ft_half.insert(ft_half.begin() + 5, 3000, -1);
+        v.insert(v.begin() + 5, 3000, -1);
+        cond = (cond && v.capacity() == ft_v.capacity() && ft_half.size() == v.size() && ft_class.size() == ft_v.size());
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i] == ft_half[i] && (i >= ft_v.size() || (ft_v[i] == ft_class[i])));
+        size_t  bytes = ft::growth_size_class::round(200), pages = ft::growth_size_class::round(300000);
+        EQUAL(cond && bytes >= 200 && ft::growth_size_class::round(bytes) == bytes && pages >= 300000 && ft::growth_size_class::round(pages) == pages);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " reserve with reallocate (mremap) " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<double>                                         v;
+        std::vector<std::string>                                    v1;
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<double, ft::MmapAllocator<double> >              ft_v;
+        ft::Vector<std::string, ft::MmapAllocator<std::string> >    ft_v1;
+        bool                                                        cond;
+
+        cond = (ft::has_reallocate<ft::MmapAllocator<double> >::value && !ft::has_reallocate<std::allocator<double> >::value);
+        for (int i = 0; i < 1000000; ++i) {
+            v.push_back(i * 0.25);
+            ft_v.push_back(i * 0.25);
+        }
+        for (int i = 0; i < 70000; ++i) {
+            v1.push_back("string");
+            ft_v1.push_back("string");
+        }
+        ft_v.reserve(3000000);
+        cond = (cond && v.size() == ft_v.size() && v1.size() == ft_v1.size() && ft_v.capacity() == 3000000);
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i] == ft_v[i]);
+        for (size_t i = 0; cond && i < v1.size(); ++i)
+            cond = (v1[i] == ft_v1[i]);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " = operator (mmap'd lhs, small rhs) " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<double>                                         v(10, 1.5);
+        std::vector<double>                                         v1(1 << 18, 2.5);
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<double, ft::MmapAllocator<double> >              ft_v(10, 1.5);
+        ft::Vector<double, ft::MmapAllocator<double> >              ft_v1(1 << 18, 2.5);
+        ft::Vector<double, ft::MmapAllocator<double> >              ft_v2;
+        bool                                                        cond;
+
+        v1 = v;
+        ft_v1 = ft_v;
+        cond = (ft_v1.size() == v1.size() && ft_v1.capacity() == (1 << 18));
+        for (size_t i = 0; cond && i < v1.size(); ++i)
+            cond = (v1[i] == ft_v1[i]);
+        ft_v2 = ft_v1;
+        ft_v1.assign(1 << 18, 3.5);
+        ft_v = ft_v1;
+        cond = (cond && ft_v2.size() == 10 && ft_v.size() == ft_v1.size() && ft_v[(1 << 18) - 1] == 3.5);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " input and forward iterator ranges " << "] --------------------]\t\t\033[0m";
+    {
+        std::list<std::string>      l;
+        bool                        cond;
+
+        for (int i = 0; i < 50; ++i)
+            l.push_back(std::string(i, 'l'));
+        /*------------------ std::vectors ---------------------*/
+        std::istringstream          in("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20");
+        std::vector<int>            v((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+        std::vector<std::string>    v1(l.begin(), l.end());
+        /*------------------ ft::vectors ---------------------*/
+        std::istringstream          ft_in("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20");
+        ft::Vector<int>             ft_v((std::istream_iterator<int>(ft_in)), std::istream_iterator<int>());
+        ft::Vector<std::string>     ft_v1(l.begin(), l.end());
+
+        cond = (v.size() == ft_v.size() && v1.size() == ft_v1.size() && ft_v1.capacity() == l.size());
+        std::istringstream          in2("100 200 300"), ft_in2("100 200 300");
+        v.insert(v.begin() + 5, std::istream_iterator<int>(in2), std::istream_iterator<int>());
+        ft_v.insert(ft_v.begin() + 5, std::istream_iterator<int>(ft_in2), std::istream_iterator<int>());
+        v1.insert(v1.begin() + 10, l.begin(), l.end());
+        ft_v1.insert(ft_v1.begin() + 10, l.begin(), l.end());
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i] == ft_v[i]);
+        for (size_t i = 0; cond && i < v1.size(); ++i)
+            cond = (v1[i] == ft_v1[i]);
+        std::istringstream          in3("7 8 9"), ft_in3("7 8 9");
+        v.assign(std::istream_iterator<int>(in3), std::istream_iterator<int>());
+        ft_v.assign(std::istream_iterator<int>(ft_in3), std::istream_iterator<int>());
+        v1.assign(++l.begin(), l.end());
+        ft_v1.assign(++l.begin(), l.end());
+        cond = (cond && v.size() == ft_v.size() && v1.size() == ft_v1.size());
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i] == ft_v[i]);
+        for (size_t i = 0; cond && i < v1.size(); ++i)
+            cond = (v1[i] == ft_v1[i]);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " default init and uninitialized resize " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<double>         v(100000);
+        std::vector<std::string>    v1(10, "string");
+        /*------------------ ft::vectors ---------------------*/
+        ft::Vector<double>          ft_v(100000, ft::default_init);
+        ft::Vector<std::string>     ft_v1(10, "string");
+        bool                        cond;
+
+        cond = (ft_v.size() == v.size() && ft_v.capacity() == v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+            v[i] = i * 0.5;
+            ft_v[i] = i * 0.5;
+        }
+        v.resize(300000);
+        ft_v.resize_uninitialized(300000);
+        for (size_t i = 100000; i < v.size(); ++i) {
+            v[i] = i * 0.5;
+            ft_v[i] = i * 0.5;
+        }
+        v.resize(1000);
+        ft_v.resize_uninitialized(1000);
+        cond = (cond && ft_v.size() == v.size());
+        for (size_t i = 0; cond && i < v.size(); ++i)
+            cond = (v[i] == ft_v[i]);
+        v1.resize(25);
+        ft_v1.resize_default_init(25);
+        v1.resize(5);
+        ft_v1.resize_default_init(5);
+        v1.resize(15);
+        ft_v1.resize_default_init(15);
+        cond = (cond && ft_v1.size() == v1.size());
+        for (size_t i = 0; cond && i < v1.size(); ++i)
+            cond = (v1[i] == ft_v1[i]);
+        EQUAL(cond);
+    }
     std::cout << "\033[1;36m\n<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\033[0m\n\n";
 } // vec_end
 
+/*
+ * Stateful allocator: every block remembers the id of the allocator that handed it out, a block released through
+ * an allocator with another id is counted in foreign_frees
+ */
+size_t  foreign_frees = 0;
+
+template <class T>
+struct tagged_allocator : std::allocator<T> {
+    template <class U> struct rebind {
+        typedef tagged_allocator<U> other;
+    };
+
+    int     id;
+
+    tagged_allocator(int tag = 0) : id(tag) {}
+    template <class U>
+    tagged_allocator(const tagged_allocator<U>& x) : id(x.id) {}
+
+    T*      allocate(size_t n, const void* = 0) {
+        int     *block = static_cast<int*>(::operator new(n * sizeof(T) + sizeof(max_align_t)));
+
+        *block = id;
+        return (reinterpret_cast<T*>(reinterpret_cast<char*>(block) + sizeof(max_align_t)));
+    }
+    void    deallocate(T* p, size_t) {
+        int     *block = reinterpret_cast<int*>(reinterpret_cast<char*>(p) - sizeof(max_align_t));
+
+        if (*block != id)
+            foreign_frees++;
+        ::operator delete(block);
+    }
+};
+
+void    small_vector_tests(void)
+{
+    std::cout << "\033[1;36m<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< SmallVector tests >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\033[0m\n\n";
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " inline storage " << "] --------------------]\t\t\033[0m";
+    {
+        ft::SmallVector<std::string, 8>     ft_v;
+        bool                                cond;
+
+        for (int i = 0; i < 8; ++i)
+            ft_v.push_back(std::string(i, 'a'));
+        cond = (ft_v.is_inline() && ft_v.capacity() == 8 && ft_v.size() == 8);
+        ft_v.push_back("spill");
+        cond = (cond && !ft_v.is_inline() && ft_v.capacity() >= 9 && ft_v.back() == "spill" && ft_v[7] == "aaaaaaa");
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " modifiers " << "] --------------------]\t\t\033[0m";
+    {
+        /*------------------ std::vectors ---------------------*/
+        std::vector<std::string>            v;
+        /*------------------ ft::SmallVector ---------------------*/
+        ft::SmallVector<std::string, 4>     ft_v;
+        std::string                         s1, ft_s1;
+
+        for (int i = 0; i < 3; ++i) {
+            v.push_back(std::string(i + 1, 'a' + i));
+            ft_v.push_back(std::string(i + 1, 'a' + i));
+        }
+        v.insert(v.begin() + 1, "in");
+        ft_v.insert(ft_v.begin() + 1, "in");
+        v.insert(v.begin(), 3, "three");
+        ft_v.insert(ft_v.begin(), 3, "three");
+        std::vector<std::string>            src(5, "src");
+        v.insert(v.end(), src.begin(), src.end());
+        ft_v.insert(ft_v.end(), src.begin(), src.end());
+        v.erase(v.begin() + 2, v.begin() + 4);
+        ft_v.erase(ft_v.begin() + 2, ft_v.begin() + 4);
+        v.emplace(v.begin() + 1, 4, 'z');
+        ft_v.emplace(ft_v.begin() + 1, 4, 'z');
+        v.resize(12, "r");
+        ft_v.resize(12, "r");
+        for (size_t i = 0; i < v.size(); ++i)
+            s1 += v[i];
+        for (ft::SmallVector<std::string, 4>::iterator it = ft_v.begin(); it != ft_v.end(); ++it)
+            ft_s1 += *it;
+        EQUAL(s1 == ft_s1 && v.size() == ft_v.size());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy, move and swap " << "] --------------------]\t\t\033[0m";
+    {
+        ft::SmallVector<std::string, 4>     small(3, "s");
+        ft::SmallVector<std::string, 4>     big(10, "b");
+        ft::SmallVector<std::string, 4>     copy(big);
+        std::string                         *data = &big[0];
+        bool                                cond;
+
+        cond = (copy == big && copy.size() == 10);
+        ft::SmallVector<std::string, 4>     moved(std::move(big));
+        cond = (cond && &moved[0] == data && big.empty() && big.is_inline());
+        ft::SmallVector<std::string, 4>     moved_small(std::move(small));
+        cond = (cond && moved_small.size() == 3 && moved_small.is_inline() && small.empty());
+        moved.swap(moved_small);
+        cond = (cond && moved.size() == 3 && moved[2] == "s" && moved_small.size() == 10 && moved_small[9] == "b");
+        copy = moved;
+        cond = (cond && copy.size() == 3 && copy == moved && moved_small < copy);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " move assign with a stateful allocator " << "] --------------------]\t\t\033[0m";
+    {
+        {
+            ft::SmallVector<std::string, 4, tagged_allocator<std::string> >    lhs(3, "l", tagged_allocator<std::string>(1));
+            ft::SmallVector<std::string, 4, tagged_allocator<std::string> >    rhs(10, "r", tagged_allocator<std::string>(2));
+            ft::SmallVector<std::string, 4, tagged_allocator<std::string> >    spilled(10, "s", tagged_allocator<std::string>(3));
+
+            lhs = std::move(rhs);
+            lhs.push_back("r");
+            spilled = std::move(lhs);
+            spilled.push_back("r");
+        }
+        EQUAL(foreign_frees == 0);
+    }
+    std::cout << "\033[1;36m\n<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\033[0m\n\n";
+}
+
+/*
+ * Compares the ft algorithms with the std ones over ft::Vector<T> of every length up to 200 (so every kernel tail
+ * is exercised), with the needle absent, first, last and repeated.
+ */
+template <class T>
+bool    check_algorithms(void)
+{
+    bool    cond = true;
+
+    for (size_t n = 0; cond && n <= 200; ++n) {
+        std::vector<T>  v;
+        ft::Vector<T>   ft_v;
+
+        for (size_t i = 0; i < n; ++i) {
+            T   x = static_cast<T>((i * 37 + 11) % 101);
+
+            v.push_back(x);
+            ft_v.push_back(x);
+        }
+        for (int needle = -1; cond && needle <= 101; needle += 17) {
+            T   x = static_cast<T>(needle);
+
+            cond = ((std::find(v.begin(), v.end(), x) - v.begin()) == (ft::find(ft_v.begin(), ft_v.end(), x) - ft_v.begin())
+                    && std::count(v.begin(), v.end(), x) == ft::count(ft_v.begin(), ft_v.end(), x)
+                    && (std::find(v.begin(), v.end(), x) != v.end()) == ft::contains(ft_v.begin(), ft_v.end(), x));
+        }
+        if (n != 0) {
+            cond = (cond && (std::find(v.begin(), v.end(), v.back()) - v.begin()) == (ft::find(ft_v.begin(), ft_v.end(), ft_v.back()) - ft_v.begin()));
+            cond = (cond && (std::min_element(v.begin(), v.end()) - v.begin()) == (ft::min_element(ft_v.begin(), ft_v.end()) - ft_v.begin()));
+            cond = (cond && (std::max_element(v.begin(), v.end()) - v.begin()) == (ft::max_element(ft_v.begin(), ft_v.end()) - ft_v.begin()));
+        }
+        cond = (cond && std::accumulate(v.begin(), v.end(), T()) == ft::sum(ft_v.begin(), ft_v.end()));
+    }
+    return (cond);
+}
+
+/*
+ * Compares the relational operators of ft::Vector<T> with std::vector<T> on pairs of vectors differing at every
+ * position, in both directions, and on prefixes of each other.
+ */
+template <class T>
+bool    check_comparisons(void)
+{
+    bool    cond = true;
+
+    for (size_t n = 0; cond && n <= 80; ++n) {
+        std::vector<T>  v;
+        ft::Vector<T>   ft_v;
+
+        for (size_t i = 0; i < n; ++i) {
+            v.push_back(static_cast<T>(i * 13 + 200));
+            ft_v.push_back(static_cast<T>(i * 13 + 200));
+        }
+        for (size_t pos = 0; cond && pos <= n; ++pos) {
+            std::vector<T>  v1(v.begin(), v.begin() + pos);
+            ft::Vector<T>   ft_v1(ft_v.begin(), ft_v.begin() + pos);
+
+            if (pos < n) {
+                v1 = v;
+                ft_v1 = ft_v;
+                v1[pos] = static_cast<T>(v1[pos] ^ static_cast<T>(0x80));
+                ft_v1[pos] = static_cast<T>(ft_v1[pos] ^ static_cast<T>(0x80));
+            }
+            cond = ((v == v1) == (ft_v == ft_v1) && (v != v1) == (ft_v != ft_v1)
+                    && (v < v1) == (ft_v < ft_v1) && (v1 < v) == (ft_v1 < ft_v)
+                    && (v <= v1) == (ft_v <= ft_v1) && (v > v1) == (ft_v > ft_v1) && (v >= v1) == (ft_v >= ft_v1));
+        }
+    }
+    return (cond);
+}
+
+void    algorithm_tests(void)
+{
+    std::cout << "\033[1;36m<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Algorithm tests >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\033[0m\n\n";
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " find, count, min, max, sum (8/16 bit) " << "] --------------------]\t\t\033[0m";
+    {
+        EQUAL(check_algorithms<char>() && check_algorithms<unsigned char>() && check_algorithms<short>() && check_algorithms<unsigned short>());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " find, count, min, max, sum (32/64 bit) " << "] --------------------]\t\t\033[0m";
+    {
+        EQUAL(check_algorithms<int32_t>() && check_algorithms<uint32_t>() && check_algorithms<int64_t>() && check_algorithms<uint64_t>());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " find, count, min, max, sum (floating) " << "] --------------------]\t\t\033[0m";
+    {
+        EQUAL(check_algorithms<float>() && check_algorithms<double>());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " relational operators (bytes) " << "] --------------------]\t\t\033[0m";
+    {
+        EQUAL(check_comparisons<unsigned char>() && check_comparisons<char>() && check_comparisons<signed char>() && check_comparisons<bool>());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " relational operators (integers) " << "] --------------------]\t\t\033[0m";
+    {
+        EQUAL(check_comparisons<short>() && check_comparisons<uint16_t>() && check_comparisons<int>() && check_comparisons<uint32_t>()
+              && check_comparisons<int64_t>() && check_comparisons<uint64_t>());
+    }
+    std::cout << "\033[1;37m[-------------------- [" << std::setw(40) << std::left << " extreme values and mixed types " << "] --------------------]\t\t\033[0m";
+    {
+        ft::Vector<uint32_t>    ft_v(1000, 7);
+        ft::Vector<int8_t>      ft_v1(1000, -3);
+        std::list<int>          l(10, 4);
+        bool                    cond;
+
+        ft_v[600] = 0xFFFFFFFFu;
+        ft_v[900] = 0;
+        ft_v1[500] = -128;
+        ft_v1[700] = 127;
+        cond = (ft::max_element(ft_v.begin(), ft_v.end()) - ft_v.begin() == 600 && ft::min_element(ft_v.begin(), ft_v.end()) - ft_v.begin() == 900);
+        cond = (cond && ft::min_element(ft_v1.begin(), ft_v1.end()) - ft_v1.begin() == 500 && ft::max_element(ft_v1.begin(), ft_v1.end()) - ft_v1.begin() == 700);
+        cond = (cond && ft::find(ft_v.begin(), ft_v.end(), -1) - ft_v.begin() == 600 && ft::count(ft_v1.begin(), ft_v1.end(), 253) == 0);
+        cond = (cond && ft::count(ft_v.begin(), ft_v.end(), 7.5) == 0 && ft::count(ft_v.begin(), ft_v.end(), 7.0) == 998);
+        cond = (cond && ft::count(l.begin(), l.end(), 4) == 10 && ft::sum(l.begin(), l.end()) == 40);
+        ft::Vector<char>        ft_v2(100000, 'a');
+        ft::Vector<short>       ft_v3(200000, 9);
+        cond = (cond && ft::count(ft_v2.begin(), ft_v2.end(), 'a') == 100000 && ft::count(ft_v3.begin() + 1, ft_v3.end(), 9) == 199999);
+        EQUAL(cond);
+    }
+    std::cout << "\033[1;36m\n<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\033[0m\n\n";
+}
+
 void alarm_handler(int seg)
 {
     (void)seg;
@@ -3216,5 +3752,7 @@ int main(void)
     reverse_iterator_tests();
 	reverse_iterator_with_ft_vector();
     vector_tests();
+    small_vector_tests();
+    algorithm_tests();
     return 0;
 }
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   growth_policy.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/02 10:14:51 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/02 10:14:51 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+# include <cstddef>
+# include <cstdlib>
+
+namespace ft {
+	/** @brief Growth policies for Vector reallocation
+	 * A growth policy decides the new capacity of a vector whose storage is exhausted. It exposes a single static
+	 * member function:
+	 *
+	 *     size_t grow(size_t size, size_t required, size_t value_size)
+	 *
+	 * where size is the current number of elements, required the minimum capacity needed by the pending insertion
+	 * and value_size the size in bytes of one element. The returned capacity shall not be less than required.
+	 */
+
+
+
+	/** @brief Double the size
+	 * The new capacity is twice the current size, or the required capacity if that is larger.
+	 * This is the growth of the standard library vectors, and the default of ft::Vector.
+	 */
+	struct growth_double {
+		static size_t	grow(size_t size, size_t required, size_t) {
+			size_t	next = size * 2;
+
+			return (next < required ? required : next);
+		}
+	};
+
+
+
+	/** @brief Grow by half of the size
+	 * The new capacity is one and a half times the current size, or the required capacity if that is larger.
+	 *
+	 * With a factor under the golden ratio, the sum of the blocks freed by previous reallocations eventually
+	 * becomes large enough to hold a new block, so the allocator can reuse them, and the peak memory during a
+	 * bulk load stays closer to the final size.
+	 *
+	 * That only holds for blocks the allocator keeps in it's heap. Blocks large enough to be mapped (from 128 kB
+	 * with glibc) go back to the kernel when freed, and the peak is the old block plus the new one during the
+	 * last relocation, whatever the factor: a smaller factor then mostly buys more relocations. To keep the
+	 * peak at the payload, grow large vectors with ft::MmapAllocator, which moves the pages with mremap.
+	 */
+	struct growth_half {
+		static size_t	grow(size_t size, size_t required, size_t) {
+			size_t	next = size + size / 2;
+
+			return (next < required ? required : next);
+		}
+	};
+
+
+
+	/** @brief Grow by half and round up to the allocator size class
+	 * Grows like growth_half, then rounds the requested bytes up to the size of the block the allocator would
+	 * hand out anyway, so the slack at the end of the block becomes usable capacity instead of being wasted.
+	 *
+	 * The size classes are those of malloc, which backs std::allocator through operator new, computed without
+	 * allocating anything. With glibc, a heap chunk is the request plus a size_t header rounded to 16 bytes
+	 * (32 at least), and a request past the mmap threshold (128 kB unless malloc raised it) is rounded to the
+	 * largest one that still fits the same whole pages. Elsewhere, requests are rounded to 16 bytes, then four
+	 * classes per power of two up to a page, then whole pages. With an allocator that does not take it's blocks
+	 * from malloc, use growth_half.
+	 */
+	struct growth_size_class {
+		static const size_t	page_size = 4096;
+		static const size_t	mmap_threshold = 128 * 1024;
+
+		static size_t	round(size_t bytes) {
+# ifdef __GLIBC__
+			const size_t	header = sizeof(size_t);
+			const size_t	align = 2 * header;
+			size_t			chunk = (bytes + header + align - 1) & ~(align - 1);
+
+			if (chunk < 2 * align)
+				chunk = 2 * align;
+			if (chunk < mmap_threshold)
+				return (chunk - header);
+			chunk = (chunk + header + page_size - 1) / page_size * page_size;
+			return (chunk - header - align);
+# else
+			if (bytes <= 128)
+				return ((bytes + 15) & ~static_cast<size_t>(15));
+			if (bytes <= page_size) {
+				size_t	step = 128;
+
+				while (step * 2 < bytes)
+					step *= 2;
+				step /= 4;
+				return ((bytes + step - 1) / step * step);
+			}
+			return ((bytes + page_size - 1) / page_size * page_size);
+# endif
+		}
+		static size_t	grow(size_t size, size_t required, size_t value_size) {
+			size_t	next = growth_half::grow(size, required, value_size);
+
+			if (value_size == 0)
+				return (next);
+			return (round(next * value_size) / value_size);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_storage.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/03 09:12:40 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/03 09:12:40 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VECTOR_STORAGE_HPP
+#define VECTOR_STORAGE_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <utility>
+# include "../utils/utils.hpp"
+
+namespace ft {
+	/** @brief Element moves over the contiguous storage of ft::Vector and ft::SmallVector
+	 * Every operation takes the allocator of the container and a block of raw storage, and comes in two flavours:
+	 * trivially copyable (or destructible) elements are moved with memmove or memcpy, or not touched at all, the
+	 * others go through the allocator's construct and destroy one element at a time.
+	 *
+	 * @tparam Alloc The allocator of the container
+	 */
+	template <class Alloc>
+	struct vector_storage {
+		typedef typename Alloc::value_type		value_type;
+		typedef typename Alloc::pointer			pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+		typedef size_t							size_type;
+
+		/** @brief Open a gap of n slots at pos in the size elements of data
+		 * Moves the elements [pos, size) n slots towards the end. Slots landing past the old end are constructed,
+		 * the others are move assigned. The gap [pos, pos + n) is left as raw storage, the caller constructs the
+		 * new elements there. data must already hold size + n elements.
+		 */
+		static void	shift_right(Alloc& alloc, pointer data, size_type size, size_type pos, size_type n) {
+			shift_right(alloc, data, size, pos, n, ft::is_trivially_copyable<value_type>());
+		}
+
+		/** @brief Close the n slots starting at pos in the size elements of data
+		 * Move assigns the elements [pos + n, size) n slots towards the beginning and destroys the n trailing
+		 * elements left behind.
+		 */
+		static void	shift_left(Alloc& alloc, pointer data, size_type size, size_type pos, size_type n) {
+			shift_left(alloc, data, size, pos, n, ft::is_trivially_copyable<value_type>());
+		}
+
+		/** @brief Relocate n elements from src into the raw storage at dst
+		 * Trivially copyable elements are carried over with a single memcpy, the others are move constructed (or
+		 * copied when their move may throw) and the source element destroyed.
+		 */
+		static void	relocate(Alloc& alloc, pointer dst, pointer src, size_type n) {
+			relocate(alloc, dst, src, n, ft::is_trivially_copyable<value_type>());
+		}
+
+		/** @brief Copy construct n elements from src into the raw storage at dst
+		 */
+		static void	copy(Alloc& alloc, pointer dst, const_pointer src, size_type n) {
+			copy(alloc, dst, src, n, ft::is_trivially_copyable<value_type>());
+		}
+
+		/** @brief Destroy the elements in [first, last)
+		 * Nothing is done for trivially destructible elements.
+		 */
+		static void	destroy(Alloc& alloc, pointer first, pointer last) {
+			destroy(alloc, first, last, ft::is_trivially_destructible<value_type>());
+		}
+
+	private:
+		static void	shift_right(Alloc&, pointer data, size_type size, size_type pos, size_type n, ft::true_type) {
+			if (pos < size)
+				std::memmove(static_cast<void*>(data + pos + n), data + pos, (size - pos) * sizeof(value_type));
+		}
+		static void	shift_right(Alloc& alloc, pointer data, size_type size, size_type pos, size_type n, ft::false_type) {
+			for (size_type i = size; i > pos; i--) {
+				if (i - 1 + n >= size)
+					alloc.construct(&data[i - 1 + n], std::move(data[i - 1]));
+				else
+					data[i - 1 + n] = std::move(data[i - 1]);
+			}
+			for (size_type i = pos; i < pos + n && i < size; i++)
+				alloc.destroy(&data[i]);
+		}
+
+		static void	shift_left(Alloc&, pointer data, size_type size, size_type pos, size_type n, ft::true_type) {
+			if (pos + n < size)
+				std::memmove(static_cast<void*>(data + pos), data + pos + n, (size - pos - n) * sizeof(value_type));
+		}
+		static void	shift_left(Alloc& alloc, pointer data, size_type size, size_type pos, size_type n, ft::false_type) {
+			for (size_type i = pos + n; i < size; i++)
+				data[i - n] = std::move(data[i]);
+			destroy(alloc, data + size - n, data + size);
+		}
+
+		static void	relocate(Alloc&, pointer dst, pointer src, size_type n, ft::true_type) {
+			if (n != 0)
+				std::memcpy(static_cast<void*>(dst), src, n * sizeof(value_type));
+		}
+		static void	relocate(Alloc& alloc, pointer dst, pointer src, size_type n, ft::false_type) {
+			for (size_type i = 0; i < n ; i++) {
+				alloc.construct(&dst[i], std::move_if_noexcept(src[i]));
+				alloc.destroy(&src[i]);
+			}
+		}
+
+		static void	copy(Alloc&, pointer dst, const_pointer src, size_type n, ft::true_type) {
+			if (n != 0)
+				std::memcpy(static_cast<void*>(dst), src, n * sizeof(value_type));
+		}
+		static void	copy(Alloc& alloc, pointer dst, const_pointer src, size_type n, ft::false_type) {
+			for (size_type i = 0; i < n; i++)
+				alloc.construct(&dst[i], src[i]);
+		}
+
+		static void	destroy(Alloc&, pointer, pointer, ft::true_type) {
+		}
+		static void	destroy(Alloc& alloc, pointer first, pointer last, ft::false_type) {
+			for (; first != last; ++first)
+				alloc.destroy(first);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,248 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   algorithm.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/06 11:02:47 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/06 11:02:47 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ALGORITHM_HPP
+#define ALGORITHM_HPP
+
+# include <cstddef>
+# include <type_traits>
+# include "utils.hpp"
+# include "simd.hpp"
+# include "../Vector/iterator_traits.hpp"
+
+namespace ft {
+	/*
+	 * The algorithms below take any input (or forward) iterators. When the range is contiguous (see
+	 * ft::contiguous_iterator: pointers and ft::Vector iterators) over an arithmetic type the kernels of
+	 * utils/simd.hpp support, they run over the raw memory a register at a time, otherwise element by element.
+	 */
+
+	template <class Iterator>
+	struct _vectorized : integral_constant<bool, contiguous_iterator<Iterator>::value
+							&& simd::lane<typename contiguous_iterator<Iterator>::element_type>::vectorized> {};
+
+	template <class Iterator>
+	struct _vectorized_minmax : integral_constant<bool, contiguous_iterator<Iterator>::value
+							&& simd::lane<typename contiguous_iterator<Iterator>::element_type>::has_minmax> {};
+
+	/*
+	 * x == val. Two arithmetic operands are first cast to their common type, which is what the usual arithmetic
+	 * conversions do anyway: an unsigned element then meets a signed val without a sign-compare warning.
+	 */
+	template <class U, class T>
+	bool	_equal(const U& x, const T& val, true_type) {
+		typedef typename std::common_type<U, T>::type	common_type;
+
+		return (static_cast<common_type>(x) == static_cast<common_type>(val));
+	}
+
+	template <class U, class T>
+	bool	_equal(const U& x, const T& val, false_type) {
+		return (x == val);
+	}
+
+	template <class U, class T>
+	bool	_equal(const U& x, const T& val) {
+		return (_equal(x, val, integral_constant<bool, std::is_arithmetic<U>::value && std::is_arithmetic<T>::value>()));
+	}
+
+	template <class InputIterator, class T>
+	InputIterator	_find(InputIterator first, InputIterator last, const T& val, false_type) {
+		for (; first != last; ++first)
+			if (_equal(*first, val))
+				break ;
+		return (first);
+	}
+
+	template <class InputIterator, class T>
+	typename iterator_traits<InputIterator>::difference_type
+					_count(InputIterator first, InputIterator last, const T& val, false_type) {
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+
+		for (; first != last; ++first)
+			if (_equal(*first, val))
+				n++;
+		return (n);
+	}
+
+	template <class ForwardIterator>
+	ForwardIterator	_min_element(ForwardIterator first, ForwardIterator last, false_type) {
+		ForwardIterator	best = first;
+
+		if (first == last)
+			return (last);
+		while (++first != last)
+			if (*first < *best)
+				best = first;
+		return (best);
+	}
+
+	template <class ForwardIterator>
+	ForwardIterator	_max_element(ForwardIterator first, ForwardIterator last, false_type) {
+		ForwardIterator	best = first;
+
+		if (first == last)
+			return (last);
+		while (++first != last)
+			if (*best < *first)
+				best = first;
+		return (best);
+	}
+
+	template <class InputIterator>
+	typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type
+					_sum(InputIterator first, InputIterator last, false_type) {
+		typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type	result
+			= typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type();
+
+		for (; first != last; ++first)
+			result += *first;
+		return (result);
+	}
+
+# if defined(FT_SIMD_AVX2) || defined(FT_SIMD_SSE2)
+	template <class InputIterator, class T>
+	InputIterator	_find(InputIterator first, InputIterator last, const T& val, true_type) {
+		typedef contiguous_iterator<InputIterator>		contiguous;
+		typedef typename contiguous::element_type		element_type;
+		const element_type	needle = static_cast<element_type>(val);
+
+		/* The kernels compare in the element type: only valid when val is exactly representable in it */
+		if (static_cast<T>(needle) != val)
+			return (_find(first, last, val, false_type()));
+		const element_type	*p = contiguous::address(first);
+
+		return (InputIterator(contiguous::address(first) + simd::find(p, contiguous::address(last) - p, needle)));
+	}
+
+
+	template <class InputIterator, class T>
+	typename iterator_traits<InputIterator>::difference_type
+					_count(InputIterator first, InputIterator last, const T& val, true_type) {
+		typedef contiguous_iterator<InputIterator>		contiguous;
+		typedef typename contiguous::element_type		element_type;
+		const element_type	needle = static_cast<element_type>(val);
+
+		if (static_cast<T>(needle) != val)
+			return (_count(first, last, val, false_type()));
+		const element_type	*p = contiguous::address(first);
+
+		return (simd::count(p, contiguous::address(last) - p, needle));
+	}
+
+
+	template <class ForwardIterator>
+	ForwardIterator	_min_element(ForwardIterator first, ForwardIterator last, true_type) {
+		typedef contiguous_iterator<ForwardIterator>	contiguous;
+		const typename contiguous::element_type	*p = contiguous::address(first);
+
+		return (ForwardIterator(contiguous::address(first) + simd::min_index(p, contiguous::address(last) - p)));
+	}
+
+
+	template <class ForwardIterator>
+	ForwardIterator	_max_element(ForwardIterator first, ForwardIterator last, true_type) {
+		typedef contiguous_iterator<ForwardIterator>	contiguous;
+		const typename contiguous::element_type	*p = contiguous::address(first);
+
+		return (ForwardIterator(contiguous::address(first) + simd::max_index(p, contiguous::address(last) - p)));
+	}
+
+
+	template <class InputIterator>
+	typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type
+					_sum(InputIterator first, InputIterator last, true_type) {
+		typedef contiguous_iterator<InputIterator>	contiguous;
+		const typename contiguous::element_type	*p = contiguous::address(first);
+
+		return (simd::sum(p, contiguous::address(last) - p));
+	}
+# endif
+
+
+
+	/** @brief Find value in range
+	 * Returns an iterator to the first element in the range [first, last) that compares equal to val. If no such
+	 * element is found, the function returns last.
+	 *
+	 * @param first, last Input iterators to the initial and final positions in a sequence.
+	 * @param val Value to search for in the range
+	 * @return An iterator to the first element in the range that compares equal to val, last if none does.
+	 */
+	template <class InputIterator, class T>
+	InputIterator	find(InputIterator first, InputIterator last, const T& val) {
+		return (_find(first, last, val, integral_constant<bool, _vectorized<InputIterator>::value && std::is_arithmetic<T>::value>()));
+	}
+
+	/** @brief Count appearances of value in range
+	 * Returns the number of elements in the range [first, last) that compare equal to val.
+	 *
+	 * @param first, last Input iterators to the initial and final positions in a sequence.
+	 * @param val Value to match
+	 * @return The number of elements in the range that compare equal to val.
+	 */
+	template <class InputIterator, class T>
+	typename iterator_traits<InputIterator>::difference_type
+					count(InputIterator first, InputIterator last, const T& val) {
+		return (_count(first, last, val, integral_constant<bool, _vectorized<InputIterator>::value && std::is_arithmetic<T>::value>()));
+	}
+
+	/** @brief Test whether range contains value
+	 * @param first, last Input iterators to the initial and final positions in a sequence.
+	 * @param val Value to search for in the range
+	 * @return true if an element in the range compares equal to val, false otherwise
+	 */
+	template <class InputIterator, class T>
+	bool			contains(InputIterator first, InputIterator last, const T& val) {
+		return (ft::find(first, last, val) != last);
+	}
+
+	/** @brief Return smallest element in range
+	 * Returns an iterator pointing to the first element with the smallest value in the range [first, last).
+	 * Vectorized for contiguous integer ranges; floating point ranges keep the scalar loop, whose result with NaN
+	 * elements depends on the order of the comparisons.
+	 *
+	 * @param first, last Forward iterators to the initial and final positions in a sequence.
+	 * @return An iterator to the smallest element in the range, last if the range is empty.
+	 */
+	template <class ForwardIterator>
+	ForwardIterator	min_element(ForwardIterator first, ForwardIterator last) {
+		return (_min_element(first, last, _vectorized_minmax<ForwardIterator>()));
+	}
+
+	/** @brief Return largest element in range
+	 * Returns an iterator pointing to the first element with the largest value in the range [first, last).
+	 *
+	 * @param first, last Forward iterators to the initial and final positions in a sequence.
+	 * @return An iterator to the largest element in the range, last if the range is empty.
+	 */
+	template <class ForwardIterator>
+	ForwardIterator	max_element(ForwardIterator first, ForwardIterator last) {
+		return (_max_element(first, last, _vectorized_minmax<ForwardIterator>()));
+	}
+
+	/** @brief Sum of the elements in range
+	 * Adds the elements in the range [first, last) to a value initialized value_type. Contiguous floating point
+	 * ranges are summed one partial sum per register lane, so the result may differ from a left to right sum in
+	 * it's last bits.
+	 *
+	 * @param first, last Input iterators to the initial and final positions in a sequence.
+	 * @return The sum of the elements, value_type() for an empty range
+	 */
+	template <class InputIterator>
+	typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type
+					sum(InputIterator first, InputIterator last) {
+		return (_sum(first, last, _vectorized<InputIterator>()));
+	}
+}
+
+#endif
@@ -0,0 +1,239 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mmap_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/04 15:02:33 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/04 15:02:33 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MMAP_ALLOCATOR_HPP
+#define MMAP_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <new>
+# include <utility>
+# include <sys/mman.h>
+# include <unistd.h>
+
+namespace ft {
+	/** @brief Allocator serving large blocks from anonymous mappings backed by huge pages
+	 * Blocks of at least mmap_threshold bytes are mapped directly with mmap and released with munmap, smaller
+	 * blocks come from the regular heap through operator new.
+	 *
+	 * Mappings of at least huge_page_size bytes are aligned on huge_page_size and advised with MADV_HUGEPAGE, so
+	 * the kernel backs them with transparent huge pages when it can. One 2 MB page then covers what would take
+	 * 512 TLB entries with regular pages, which pays off on random access over large tables. The advice is a
+	 * hint: when transparent huge pages are disabled the block simply keeps regular pages.
+	 *
+	 * Mapped blocks can grow with reallocate(), which on Linux asks the kernel to move the pages with mremap
+	 * instead of copying them, so growing a multi-gigabyte buffer copies no bytes and never holds two copies
+	 * at once. Grown blocks stay aligned on huge_page_size. Containers use reallocate() only for trivially
+	 * copyable elements (see ft::has_reallocate), the others go through the usual allocate/construct/deallocate
+	 * path.
+	 *
+	 * The allocator is stateless: any two instances compare equal.
+	 *
+	 * @tparam T Type of the elements allocated
+	 */
+	template <class T>
+	class MmapAllocator {
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template <class U> struct rebind {
+				typedef MmapAllocator<U> other;
+			};
+
+			/**
+			 * Size in bytes from which blocks are mapped instead of taken from the heap
+			 */
+			static const size_type	mmap_threshold = 1 << 20;
+
+			/**
+			 * Size in bytes of a transparent huge page, and alignment of the mappings that can hold one
+			 */
+			static const size_type	huge_page_size = 2 << 20;
+
+			MmapAllocator() {
+				return ;
+			}
+			template <class U>
+			MmapAllocator(const MmapAllocator<U>&) {
+				return ;
+			}
+			~MmapAllocator() {
+				return ;
+			}
+
+			pointer			address(reference x) const {
+				return (&x);
+			}
+			const_pointer	address(const_reference x) const {
+				return (&x);
+			}
+
+			size_type		max_size() const {
+				return (static_cast<size_type>(-1) / 2 / sizeof(value_type));
+			}
+
+			/** @brief Allocate block of storage
+			 * @param n Number of elements to allocate storage for
+			 * @return A pointer to the first element of the block
+			 * @throw bad_alloc if the block could not be obtained
+			 */
+			pointer			allocate(size_type n, const void* = 0) {
+				size_type	bytes = n * sizeof(value_type);
+
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (bytes < mmap_threshold)
+					return (static_cast<pointer>(::operator new(bytes)));
+				return (static_cast<pointer>(_map(_pages(bytes))));
+			}
+
+			/** @brief Release block of storage
+			 * @param p Pointer returned by allocate or reallocate
+			 * @param n Number of elements the block was allocated for
+			 */
+			void			deallocate(pointer p, size_type n) {
+				size_type	bytes = n * sizeof(value_type);
+
+				if (bytes < mmap_threshold)
+					::operator delete(p);
+				else
+					munmap(p, _pages(bytes));
+			}
+
+			/** @brief Grow a block of storage, carrying it's bytes over
+			 * The first old_n elements of p are found, bitwise, at the beginning of the returned block. When both sizes
+			 * are mapped, the pages are moved by the kernel with mremap (Linux), otherwise a new block is allocated,
+			 * the bytes copied and the old block released.
+			 *
+			 * Only meaningful for trivially copyable elements.
+			 *
+			 * @param p Pointer returned by allocate or reallocate
+			 * @param old_n Number of elements p was allocated for
+			 * @param new_n Number of elements to allocate storage for
+			 * @return A pointer to the grown block. p must not be used anymore
+			 * @throw bad_alloc if the block could not be grown, p is left untouched
+			 */
+			pointer			reallocate(pointer p, size_type old_n, size_type new_n) {
+				size_type	old_bytes = old_n * sizeof(value_type);
+				size_type	new_bytes = new_n * sizeof(value_type);
+
+# ifdef __linux__
+				if (old_bytes >= mmap_threshold && new_bytes >= mmap_threshold) {
+					if (new_n > max_size())
+						throw std::bad_alloc();
+					return (static_cast<pointer>(_remap(p, _pages(old_bytes), _pages(new_bytes))));
+				}
+# endif
+				pointer	block = allocate(new_n);
+
+				std::memcpy(static_cast<void*>(block), p, (old_bytes < new_bytes) ? old_bytes : new_bytes);
+				deallocate(p, old_n);
+				return (block);
+			}
+
+			template <class U, class... Args>
+			void			construct(U* p, Args&&... args) {
+				::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+			template <class U>
+			void			destroy(U* p) {
+				p->~U();
+			}
+
+		private:
+			/** @brief Map length bytes, huge page aligned when length can hold a huge page
+			 * The mapping is over-sized by one huge page, then the unaligned head and the extra tail are unmapped.
+			 */
+			static void		*_map(size_type length) {
+				size_type	span = (length >= huge_page_size) ? length + huge_page_size : length;
+				void		*raw = mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if (raw == MAP_FAILED)
+					throw std::bad_alloc();
+				if (span == length)
+					return (raw);
+				char	*begin = static_cast<char*>(raw);
+				char	*block = begin + (huge_page_size - reinterpret_cast<size_t>(begin) % huge_page_size) % huge_page_size;
+				char	*end = begin + span;
+
+				if (block != begin)
+					munmap(begin, block - begin);
+				if (block + length != end)
+					munmap(block + length, end - (block + length));
+				_advise(block, length);
+				return (block);
+			}
+
+# ifdef __linux__
+			/** @brief Move the pages of a mapping to a mapping of new_length bytes
+			 * A mapping that can hold a huge page must stay aligned on huge_page_size, which mremap with MREMAP_MAYMOVE
+			 * does not care about. Such a mapping is first grown where it stands when it is aligned and the address
+			 * space after it is free, otherwise it's pages are moved with MREMAP_FIXED onto an aligned mapping
+			 * reserved by _map. Either way no byte is copied.
+			 */
+			static void		*_remap(void *block, size_type old_length, size_type new_length) {
+				void	*moved = MAP_FAILED;
+
+				if (new_length < huge_page_size)
+					moved = mremap(block, old_length, new_length, MREMAP_MAYMOVE);
+				else {
+					if (reinterpret_cast<size_t>(block) % huge_page_size == 0)
+						moved = mremap(block, old_length, new_length, 0);
+					if (moved == MAP_FAILED) {
+						void	*target = _map(new_length);
+
+						moved = mremap(block, old_length, new_length, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+						if (moved == MAP_FAILED)
+							munmap(target, new_length);
+					}
+				}
+				if (moved == MAP_FAILED)
+					throw std::bad_alloc();
+				_advise(moved, new_length);
+				return (moved);
+			}
+# endif
+
+			static void		_advise(void *block, size_type length) {
+# ifdef MADV_HUGEPAGE
+				if (length >= huge_page_size)
+					madvise(block, length, MADV_HUGEPAGE);
+# else
+				(void)block;
+				(void)length;
+# endif
+			}
+
+			static size_type	_pages(size_type bytes) {
+				static const size_type	page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+
+				return ((bytes + page - 1) / page * page);
+			}
+	};
+
+	template <class T, class U>
+	bool	operator==(const MmapAllocator<T>&, const MmapAllocator<U>&) {
+		return (true);
+	}
+	template <class T, class U>
+	bool	operator!=(const MmapAllocator<T>&, const MmapAllocator<U>&) {
+		return (false);
+	}
+}
+
+#endif
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_update.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/16 11:02:37 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/16 11:02:37 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_UPDATE_HPP
+#define NODE_UPDATE_HPP
+
+# include <cstddef>
+
+namespace ft {
+	/** @brief Node update policies for red_black_tree
+	 * A node update policy keeps a summary of every subtree in it's root node. It exposes:
+	 *
+	 *     struct metadata_type
+	 *     static const bool enabled
+	 *     template <class Node> static void update(Node* node)
+	 *
+	 * Every node of the tree derives from metadata_type. update recomputes the metadata of node from it's value
+	 * and the metadata of it's children (either may be nullptr); the tree calls it on every node whose subtree
+	 * changes, bottom up, after links are changed by an insertion, an erasure or a rotation. A policy that is not
+	 * enabled is never called, and costs neither memory nor time.
+	 */
+
+
+
+	/** @brief Keep nothing
+	 * The default of ft::Map and ft::Set.
+	 */
+	struct rbt_null_node_update {
+		struct metadata_type {
+		};
+
+		static const bool	enabled = false;
+
+		template <class Node>
+		static void	update(Node*) {
+		}
+	};
+
+
+
+	/** @brief Keep the size of every subtree
+	 * With the subtree sizes the tree finds the element of a given index, or the index of an element, in one
+	 * descent (see red_black_tree::select and red_black_tree::rank), at the cost of a size_t per node.
+	 */
+	struct rbt_order_statistics_node_update {
+		struct metadata_type {
+			size_t	subtree_size;
+
+			metadata_type() : subtree_size(0) {
+			}
+		};
+
+		static const bool	enabled = true;
+
+		template <class Node>
+		static size_t	size(const Node* node) {
+			return (node != nullptr ? node->subtree_size : 0);
+		}
+		template <class Node>
+		static void	update(Node* node) {
+			node->subtree_size = size(node->left) + size(node->right) + 1;
+		}
+	};
+
+
+
+	/** @brief Keep a monoid summary of every subtree
+	 * The summary of a subtree folds the summaries of it's elements in order, so the tree folds any range of
+	 * keys in one descent (see red_black_tree::aggregate). Monoid exposes:
+	 *
+	 *     typedef ... summary_type
+	 *     static summary_type identity()
+	 *     static summary_type summarize(const value_type& element)
+	 *     static summary_type combine(const summary_type& lhs, const summary_type& rhs)
+	 *
+	 * combine shall be associative, with identity as it's identity element; it needs not be commutative, lhs
+	 * always summarizing the elements before those of rhs. A sum, a minimum or a maximum of some member of the
+	 * elements all fit.
+	 */
+	template <class Monoid>
+	struct rbt_aggregate_node_update {
+		typedef Monoid							monoid_type;
+		typedef typename Monoid::summary_type	summary_type;
+
+		struct metadata_type {
+			summary_type	summary;
+
+			metadata_type() : summary(Monoid::identity()) {
+			}
+		};
+
+		static const bool	enabled = true;
+
+		template <class Node>
+		static summary_type	summary(const Node* node) {
+			return (node != nullptr ? node->summary : Monoid::identity());
+		}
+		template <class Node>
+		static void	update(Node* node) {
+			node->summary = Monoid::combine(Monoid::combine(summary(node->left), Monoid::summarize(node->data)),
+				summary(node->right));
+		}
+	};
+}
+
+#endif
@@ -14,6 +14,8 @@
 #ifndef PAIR_HPP
 #define PAIR_HPP
 # include <iostream>
+# include <utility>
+# include <type_traits>
 
 
 /** @brief Implementation for std::pair and std::make_pair template objects
@@ -22,6 +24,13 @@
  */
 
 namespace ft {
+	/** @brief Piecewise construction tag
+	 * Selects the constructor of pair that copies it's first argument into first and builds second in place from
+	 * the others, so a second_type that can't be copied still fits in a pair (see red_black_tree::try_emplace).
+	 */
+	struct piecewise_construct_t {};
+	static const piecewise_construct_t	piecewise_construct = piecewise_construct_t();
+
 	/** Pair of values
 	 * This class couples together a pair of values, which my be of different types
 	 * (T1, and T2). The individual values can be accessed through it's public
@@ -71,6 +80,19 @@ namespace ft {
 			pair(const pair<U, V>& pr): first(pr.first), second(pr.second) {
 				return ;
 			}
+			pair(const pair& pr): first(pr.first), second(pr.second) {
+				return ;
+			}
+
+			/** @brief Move constructor
+			 * Moves the members of pr; a const first (the key of a map) is copied.
+			 *
+			 * @param pr Another pair object of the same type, left in a valid but unspecified state.
+			 */
+			pair(pair&& pr) noexcept(std::is_nothrow_move_constructible<first_type>::value
+				&& std::is_nothrow_move_constructible<second_type>::value): first(std::move(pr.first)), second(std::move(pr.second)) {
+				return ;
+			}
 
 
 			/** @brief Initialization constructor
@@ -91,6 +113,17 @@ namespace ft {
 				return ;
 			}
 
+			/** @brief Piecewise constructor
+			 * Copies a into first and constructs second in place, passing it args.
+			 *
+			 * @param a An object of the type of first
+			 * @param args The arguments of the constructor of second
+			 */
+			template <class... Args>
+			pair (ft::piecewise_construct_t, const first_type& a, Args&&... args): first(a), second(std::forward<Args>(args)...) {
+				return ;
+			}
+
 
 			/**@brief Assign contents
 			 * Assigns pr as the new content for the pair object.
@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/08 10:14:52 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/08 10:14:52 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <utility>
+
+namespace ft {
+	/** @brief Allocator carving single elements out of large slabs
+	 * Node based containers allocate their nodes one at a time. PoolAllocator serves those single element requests
+	 * from slabs of SlabBytes bytes, cut one cell after the other, and keeps the cells given back by deallocate() on
+	 * a free list that the next allocate() pops first. Under insert/erase churn nodes are then recycled without
+	 * going through malloc/free, and stay packed in a few slabs instead of being scattered over the heap.
+	 * Requests for more than one element go to operator new.
+	 *
+	 * Slabs are only returned to the system by release() (or destruction), all at once. A red_black_tree whose node
+	 * allocator provides release() (see ft::has_release) uses it to clear itself without freeing it's nodes one by
+	 * one.
+	 *
+	 * The allocator is stateful and owns it's pool: a copy starts with an empty pool, copy assignment keeps the
+	 * destination's pool, and moving transfers the pool. Memory must be given back to the allocator instance it
+	 * came from. Opt a container in through it's Alloc parameter:
+	 *     ft::Map<int, std::string, std::less<int>, ft::PoolAllocator<ft::pair<const int, std::string> > >
+	 *
+	 * @tparam T Type of the elements allocated
+	 * @tparam SlabBytes Size in bytes of the slabs
+	 */
+	template <class T, size_t SlabBytes = 64 * 1024>
+	class PoolAllocator {
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template <class U> struct rebind {
+				typedef PoolAllocator<U, SlabBytes> other;
+			};
+
+		private:
+			/*
+			 * A free cell holds the link to the next free cell, a slab starts with the link to the next slab.
+			 */
+			struct _link {
+				_link	*next;
+			};
+
+			static const size_type	_align = (alignof(T) > alignof(_link)) ? alignof(T) : alignof(_link);
+			static const size_type	_cell = ((sizeof(T) > sizeof(_link) ? sizeof(T) : sizeof(_link)) + _align - 1) / _align * _align;
+			static const size_type	_header = (sizeof(_link) + _align - 1) / _align * _align;
+			static const size_type	_slab = (SlabBytes > _header + _cell) ? SlabBytes : _header + _cell;
+
+			_link	*_slabs;
+			_link	*_free;
+			char	*_cursor;
+			char	*_end;
+
+		public:
+			PoolAllocator() : _slabs(nullptr), _free(nullptr), _cursor(nullptr), _end(nullptr) {
+				return ;
+			}
+			PoolAllocator(const PoolAllocator&) : _slabs(nullptr), _free(nullptr), _cursor(nullptr), _end(nullptr) {
+				return ;
+			}
+			template <class U>
+			PoolAllocator(const PoolAllocator<U, SlabBytes>&) : _slabs(nullptr), _free(nullptr), _cursor(nullptr), _end(nullptr) {
+				return ;
+			}
+			PoolAllocator(PoolAllocator&& x) : _slabs(x._slabs), _free(x._free), _cursor(x._cursor), _end(x._end) {
+				x._slabs = nullptr;
+				x._free = nullptr;
+				x._cursor = nullptr;
+				x._end = nullptr;
+			}
+			~PoolAllocator() {
+				release();
+			}
+
+			PoolAllocator&	operator=(const PoolAllocator&) {
+				return (*this);
+			}
+			PoolAllocator&	operator=(PoolAllocator&& x) {
+				if (this != &x) {
+					release();
+					std::swap(_slabs, x._slabs);
+					std::swap(_free, x._free);
+					std::swap(_cursor, x._cursor);
+					std::swap(_end, x._end);
+				}
+				return (*this);
+			}
+
+			pointer			address(reference x) const {
+				return (&x);
+			}
+			const_pointer	address(const_reference x) const {
+				return (&x);
+			}
+
+			size_type		max_size() const {
+				return (static_cast<size_type>(-1) / sizeof(value_type));
+			}
+
+			/** @brief Allocate block of storage
+			 * A single element is taken from the free list, or cut from the current slab, a new slab being allocated
+			 * when the current one is exhausted.
+			 *
+			 * @param n Number of elements to allocate storage for
+			 * @return A pointer to the first element of the block
+			 * @throw bad_alloc if the block could not be obtained
+			 */
+			pointer			allocate(size_type n, const void* = 0) {
+				if (n != 1) {
+					if (n > max_size())
+						throw std::bad_alloc();
+					return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
+				}
+				if (_free != nullptr) {
+					_link	*cell = _free;
+
+					_free = cell->next;
+					return (reinterpret_cast<pointer>(cell));
+				}
+				if (_cursor == _end) {
+					_link	*slab = static_cast<_link*>(::operator new(_slab));
+
+					slab->next = _slabs;
+					_slabs = slab;
+					_cursor = reinterpret_cast<char*>(slab) + _header;
+					_end = _cursor + (_slab - _header) / _cell * _cell;
+				}
+				pointer	cell = reinterpret_cast<pointer>(_cursor);
+
+				_cursor += _cell;
+				return (cell);
+			}
+
+			/** @brief Release block of storage
+			 * A single element goes back on the free list, it's slab stays allocated.
+			 *
+			 * @param p Pointer returned by allocate on this allocator
+			 * @param n Number of elements the block was allocated for
+			 */
+			void			deallocate(pointer p, size_type n) {
+				if (n != 1) {
+					::operator delete(p);
+					return ;
+				}
+				_link	*cell = reinterpret_cast<_link*>(p);
+
+				cell->next = _free;
+				_free = cell;
+			}
+
+			/** @brief Release every slab
+			 * Gives all the single elements allocated so far back to the system at once. They must not hold live
+			 * objects anymore.
+			 */
+			void			release() {
+				while (_slabs != nullptr) {
+					_link	*next = _slabs->next;
+
+					::operator delete(_slabs);
+					_slabs = next;
+				}
+				_free = nullptr;
+				_cursor = nullptr;
+				_end = nullptr;
+			}
+
+			template <class U, class... Args>
+			void			construct(U* p, Args&&... args) {
+				::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+			template <class U>
+			void			destroy(U* p) {
+				p->~U();
+			}
+	};
+
+	/*
+	 * Two pools are interchangeable only when they are the same pool.
+	 */
+	template <class T, class U, size_t SlabBytes>
+	bool	operator==(const PoolAllocator<T, SlabBytes>& lhs, const PoolAllocator<U, SlabBytes>& rhs) {
+		return (static_cast<const void*>(&lhs) == static_cast<const void*>(&rhs));
+	}
+	template <class T, class U, size_t SlabBytes>
+	bool	operator!=(const PoolAllocator<T, SlabBytes>& lhs, const PoolAllocator<U, SlabBytes>& rhs) {
+		return (!(lhs == rhs));
+	}
+}
+
+#endif
@@ -0,0 +1,462 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mashad <mashad@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/06 09:41:12 by mashad            #+#    #+#             */
+/*   Updated: 2021/12/06 09:41:12 by mashad           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+# include <cstddef>
+
+# if !defined(FT_NO_SIMD) && defined(__AVX2__)
+#  define FT_SIMD_AVX2 1
+#  include <immintrin.h>
+# elif !defined(FT_NO_SIMD) && defined(__SSE2__)
+#  define FT_SIMD_SSE2 1
+#  include <emmintrin.h>
+# endif
+
+namespace ft {
+	/** @brief Vector kernels over contiguous arithmetic arrays
+	 * The kernels work on raw arrays of integers (any width, signed or not) and floating point numbers, a register
+	 * at a time: 32 bytes when the translation unit is compiled with AVX2 (-mavx2, -march=native ...), 16 bytes with
+	 * SSE2, which every x86-64 target has. Elsewhere, or when FT_NO_SIMD is defined, no type is vectorized and the
+	 * algorithms of utils/algorithm.hpp keep their scalar loop.
+	 *
+	 * lane<T> describes how T is packed in a register. lane<T>::vectorized tells whether the kernels can be used for
+	 * T at all, lane<T>::has_minmax whether min_index and max_index can.
+	 */
+	namespace simd {
+		template <class T> struct lane {
+			static const bool	vectorized = false;
+			static const bool	has_minmax = false;
+		};
+
+# if defined(FT_SIMD_AVX2)
+		typedef __m256i		ireg;
+		static const size_t	register_bytes = 32;
+
+		inline ireg		iload(const void *p) { return (_mm256_loadu_si256(static_cast<const __m256i*>(p))); }
+		inline void		istore(void *p, ireg r) { _mm256_storeu_si256(static_cast<__m256i*>(p), r); }
+		inline unsigned	imask(ireg r) { return (static_cast<unsigned>(_mm256_movemask_epi8(r))); }
+		inline ireg		ior(ireg a, ireg b) { return (_mm256_or_si256(a, b)); }
+		inline ireg		ixor(ireg a, ireg b) { return (_mm256_xor_si256(a, b)); }
+		inline ireg		iblend(ireg m, ireg a, ireg b) { return (_mm256_blendv_epi8(b, a, m)); }
+
+		/*
+		 * Integer operations by element size. gt is the signed comparison, has_gt false when the ISA lacks it.
+		 */
+		template <size_t Size> struct int_ops;
+		template <> struct int_ops<1> {
+			static const bool	has_gt = true;
+			static ireg	set1(char v) { return (_mm256_set1_epi8(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm256_cmpeq_epi8(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm256_cmpgt_epi8(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm256_add_epi8(a, b)); }
+		};
+		template <> struct int_ops<2> {
+			static const bool	has_gt = true;
+			static ireg	set1(short v) { return (_mm256_set1_epi16(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm256_cmpeq_epi16(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm256_cmpgt_epi16(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm256_add_epi16(a, b)); }
+		};
+		template <> struct int_ops<4> {
+			static const bool	has_gt = true;
+			static ireg	set1(int v) { return (_mm256_set1_epi32(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm256_cmpeq_epi32(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm256_cmpgt_epi32(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm256_add_epi32(a, b)); }
+		};
+		template <> struct int_ops<8> {
+			static const bool	has_gt = true;
+			static ireg	set1(long long v) { return (_mm256_set1_epi64x(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm256_cmpeq_epi64(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm256_cmpgt_epi64(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm256_add_epi64(a, b)); }
+		};
+
+		struct float_lane {
+			typedef __m256		reg;
+			static const size_t		width = 8;
+			static const unsigned	mask_bits = 1;
+			static const bool		vectorized = true;
+			static const bool		has_minmax = false;
+
+			static reg		load(const float *p) { return (_mm256_loadu_ps(p)); }
+			static void		store(float *p, reg r) { _mm256_storeu_ps(p, r); }
+			static reg		set1(float v) { return (_mm256_set1_ps(v)); }
+			static reg		zero() { return (_mm256_setzero_ps()); }
+			static unsigned	eq(reg a, reg b) { return (static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)))); }
+			static ireg		eqv(reg a, reg b) { return (_mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_EQ_OQ))); }
+			static reg		add(reg a, reg b) { return (_mm256_add_ps(a, b)); }
+		};
+		struct double_lane {
+			typedef __m256d		reg;
+			static const size_t		width = 4;
+			static const unsigned	mask_bits = 1;
+			static const bool		vectorized = true;
+			static const bool		has_minmax = false;
+
+			static reg		load(const double *p) { return (_mm256_loadu_pd(p)); }
+			static void		store(double *p, reg r) { _mm256_storeu_pd(p, r); }
+			static reg		set1(double v) { return (_mm256_set1_pd(v)); }
+			static reg		zero() { return (_mm256_setzero_pd()); }
+			static unsigned	eq(reg a, reg b) { return (static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)))); }
+			static ireg		eqv(reg a, reg b) { return (_mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+			static reg		add(reg a, reg b) { return (_mm256_add_pd(a, b)); }
+		};
+# elif defined(FT_SIMD_SSE2)
+		typedef __m128i		ireg;
+		static const size_t	register_bytes = 16;
+
+		inline ireg		iload(const void *p) { return (_mm_loadu_si128(static_cast<const __m128i*>(p))); }
+		inline void		istore(void *p, ireg r) { _mm_storeu_si128(static_cast<__m128i*>(p), r); }
+		inline unsigned	imask(ireg r) { return (static_cast<unsigned>(_mm_movemask_epi8(r))); }
+		inline ireg		ior(ireg a, ireg b) { return (_mm_or_si128(a, b)); }
+		inline ireg		ixor(ireg a, ireg b) { return (_mm_xor_si128(a, b)); }
+		inline ireg		iblend(ireg m, ireg a, ireg b) { return (_mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b))); }
+
+		/*
+		 * Integer operations by element size. gt is the signed comparison, has_gt false when the ISA lacks it.
+		 */
+		template <size_t Size> struct int_ops;
+		template <> struct int_ops<1> {
+			static const bool	has_gt = true;
+			static ireg	set1(char v) { return (_mm_set1_epi8(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm_cmpeq_epi8(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm_cmpgt_epi8(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm_add_epi8(a, b)); }
+		};
+		template <> struct int_ops<2> {
+			static const bool	has_gt = true;
+			static ireg	set1(short v) { return (_mm_set1_epi16(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm_cmpeq_epi16(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm_cmpgt_epi16(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm_add_epi16(a, b)); }
+		};
+		template <> struct int_ops<4> {
+			static const bool	has_gt = true;
+			static ireg	set1(int v) { return (_mm_set1_epi32(v)); }
+			static ireg	eq(ireg a, ireg b) { return (_mm_cmpeq_epi32(a, b)); }
+			static ireg	gt(ireg a, ireg b) { return (_mm_cmpgt_epi32(a, b)); }
+			static ireg	add(ireg a, ireg b) { return (_mm_add_epi32(a, b)); }
+		};
+		template <> struct int_ops<8> {
+			static const bool	has_gt = false;
+			static ireg	set1(long long v) { return (_mm_set1_epi64x(v)); }
+			/* No 64 bit compare in SSE2: both 32 bit halves must match */
+			static ireg	eq(ireg a, ireg b) {
+				ireg	halves = _mm_cmpeq_epi32(a, b);
+
+				return (_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))));
+			}
+			static ireg	add(ireg a, ireg b) { return (_mm_add_epi64(a, b)); }
+		};
+
+		struct float_lane {
+			typedef __m128		reg;
+			static const size_t		width = 4;
+			static const unsigned	mask_bits = 1;
+			static const bool		vectorized = true;
+			static const bool		has_minmax = false;
+
+			static reg		load(const float *p) { return (_mm_loadu_ps(p)); }
+			static void		store(float *p, reg r) { _mm_storeu_ps(p, r); }
+			static reg		set1(float v) { return (_mm_set1_ps(v)); }
+			static reg		zero() { return (_mm_setzero_ps()); }
+			static unsigned	eq(reg a, reg b) { return (static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)))); }
+			static ireg		eqv(reg a, reg b) { return (_mm_castps_si128(_mm_cmpeq_ps(a, b))); }
+			static reg		add(reg a, reg b) { return (_mm_add_ps(a, b)); }
+		};
+		struct double_lane {
+			typedef __m128d		reg;
+			static const size_t		width = 2;
+			static const unsigned	mask_bits = 1;
+			static const bool		vectorized = true;
+			static const bool		has_minmax = false;
+
+			static reg		load(const double *p) { return (_mm_loadu_pd(p)); }
+			static void		store(double *p, reg r) { _mm_storeu_pd(p, r); }
+			static reg		set1(double v) { return (_mm_set1_pd(v)); }
+			static reg		zero() { return (_mm_setzero_pd()); }
+			static unsigned	eq(reg a, reg b) { return (static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(a, b)))); }
+			static ireg		eqv(reg a, reg b) { return (_mm_castpd_si128(_mm_cmpeq_pd(a, b))); }
+			static reg		add(reg a, reg b) { return (_mm_add_pd(a, b)); }
+		};
+# endif
+
+# if defined(FT_SIMD_AVX2) || defined(FT_SIMD_SSE2)
+		/** @brief Integer lane
+		 * The comparison masks come from movemask_epi8, so each element owns mask_bits = sizeof(T) bits of it.
+		 * Unsigned elements are ordered with the signed comparison after flipping their sign bit.
+		 */
+		template <class T, bool Signed = (static_cast<T>(-1) < static_cast<T>(0))>
+		struct int_lane {
+			typedef ireg				reg;
+			typedef int_ops<sizeof(T)>	ops;
+			static const size_t		width = register_bytes / sizeof(T);
+			static const unsigned	mask_bits = sizeof(T);
+			static const bool		vectorized = true;
+			static const bool		has_minmax = ops::has_gt;
+
+			static reg		load(const T *p) { return (iload(p)); }
+			static void		store(T *p, reg r) { istore(p, r); }
+			static reg		set1(T v) { return (ops::set1(v)); }
+			static reg		zero() { return (ops::set1(0)); }
+			static unsigned	eq(reg a, reg b) { return (imask(ops::eq(a, b))); }
+			static ireg		eqv(reg a, reg b) { return (ops::eq(a, b)); }
+			static reg		add(reg a, reg b) { return (ops::add(a, b)); }
+			static reg		lt(reg a, reg b) {
+				if (Signed)
+					return (ops::gt(b, a));
+				reg		bias = ops::set1(static_cast<T>(static_cast<T>(1) << (sizeof(T) * 8 - 1)));
+
+				return (ops::gt(ixor(b, bias), ixor(a, bias)));
+			}
+			static reg		min(reg a, reg b) { return (iblend(lt(b, a), b, a)); }
+			static reg		max(reg a, reg b) { return (iblend(lt(a, b), b, a)); }
+		};
+
+		template <> struct lane<char> : int_lane<char> {};
+		template <> struct lane<signed char> : int_lane<signed char> {};
+		template <> struct lane<unsigned char> : int_lane<unsigned char> {};
+		template <> struct lane<wchar_t> : int_lane<wchar_t> {};
+		template <> struct lane<char16_t> : int_lane<char16_t> {};
+		template <> struct lane<char32_t> : int_lane<char32_t> {};
+		template <> struct lane<short> : int_lane<short> {};
+		template <> struct lane<unsigned short> : int_lane<unsigned short> {};
+		template <> struct lane<int> : int_lane<int> {};
+		template <> struct lane<unsigned int> : int_lane<unsigned int> {};
+		template <> struct lane<long> : int_lane<long> {};
+		template <> struct lane<unsigned long> : int_lane<unsigned long> {};
+		template <> struct lane<long long> : int_lane<long long> {};
+		template <> struct lane<unsigned long long> : int_lane<unsigned long long> {};
+		template <> struct lane<float> : float_lane {};
+		template <> struct lane<double> : double_lane {};
+
+		/** @brief Index of the first element equal to value, n if there is none
+		 * Four registers are compared per iteration, the scalar loop takes the tail.
+		 */
+		template <class T>
+		size_t		find(const T *p, size_t n, T value) {
+			typedef lane<T>	L;
+			const typename L::reg	needle = L::set1(value);
+			size_t					i = 0;
+
+			for (; i + 4 * L::width <= n; i += 4 * L::width) {
+				unsigned	m0 = L::eq(L::load(p + i), needle);
+				unsigned	m1 = L::eq(L::load(p + i + L::width), needle);
+				unsigned	m2 = L::eq(L::load(p + i + 2 * L::width), needle);
+				unsigned	m3 = L::eq(L::load(p + i + 3 * L::width), needle);
+
+				if ((m0 | m1 | m2 | m3) == 0)
+					continue ;
+				if (m0)
+					return (i + __builtin_ctz(m0) / L::mask_bits);
+				if (m1)
+					return (i + L::width + __builtin_ctz(m1) / L::mask_bits);
+				if (m2)
+					return (i + 2 * L::width + __builtin_ctz(m2) / L::mask_bits);
+				return (i + 3 * L::width + __builtin_ctz(m3) / L::mask_bits);
+			}
+			for (; i + L::width <= n; i += L::width) {
+				unsigned	m = L::eq(L::load(p + i), needle);
+
+				if (m)
+					return (i + __builtin_ctz(m) / L::mask_bits);
+			}
+			for (; i < n; ++i)
+				if (p[i] == value)
+					return (i);
+			return (n);
+		}
+
+		/*
+		 * Unsigned integer of Size bytes, the type of the per lane match counters of count
+		 */
+		template <size_t Size> struct counter;
+		template <> struct counter<1> { typedef unsigned char		type; };
+		template <> struct counter<2> { typedef unsigned short		type; };
+		template <> struct counter<4> { typedef unsigned int		type; };
+		template <> struct counter<8> { typedef unsigned long long	type; };
+
+		/*
+		 * Sum of the match counters of count, each lane holding minus it's number of matches
+		 */
+		template <class T>
+		size_t		drain(ireg acc) {
+			typedef typename counter<sizeof(T)>::type	counter_type;
+			counter_type	lanes[register_bytes / sizeof(T)];
+			size_t			result = 0;
+
+			istore(lanes, acc);
+			for (size_t j = 0; j < register_bytes / sizeof(T); ++j)
+				result += static_cast<counter_type>(0 - lanes[j]);
+			return (result);
+		}
+
+		/** @brief Number of elements equal to value
+		 * Each lane keeps it's own counter, of the element's width, to which the all ones comparison result is added
+		 * (one less per match). The counters are drained before the narrow ones can wrap around.
+		 */
+		template <class T>
+		size_t		count(const T *p, size_t n, T value) {
+			typedef lane<T>				L;
+			typedef int_ops<sizeof(T)>	ops;
+			const typename L::reg	needle = L::set1(value);
+			const size_t			period = (sizeof(T) == 1) ? 255 : (sizeof(T) == 2) ? 65535 : static_cast<size_t>(-1);
+			ireg					acc = ops::set1(0);
+			size_t					pending = 0;
+			size_t					result = 0;
+			size_t					i = 0;
+
+			for (; i + L::width <= n; i += L::width) {
+				acc = ops::add(acc, L::eqv(L::load(p + i), needle));
+				if (++pending == period) {
+					result += drain<T>(acc);
+					acc = ops::set1(0);
+					pending = 0;
+				}
+			}
+			result += drain<T>(acc);
+			for (; i < n; ++i)
+				if (p[i] == value)
+					result++;
+			return (result);
+		}
+
+		/** @brief Index of the first position where a and b differ, n if they are equal
+		 * Two registers of each array are compared per iteration.
+		 */
+		template <class T>
+		size_t		mismatch(const T *a, const T *b, size_t n) {
+			typedef lane<T>	L;
+			const unsigned	full = (L::width * L::mask_bits == 32) ? ~0u : (1u << (L::width * L::mask_bits)) - 1;
+			size_t			i = 0;
+
+			for (; i + 2 * L::width <= n; i += 2 * L::width) {
+				unsigned	m0 = L::eq(L::load(a + i), L::load(b + i));
+				unsigned	m1 = L::eq(L::load(a + i + L::width), L::load(b + i + L::width));
+
+				if ((m0 & m1) == full)
+					continue ;
+				if (m0 != full)
+					return (i + __builtin_ctz(~m0) / L::mask_bits);
+				return (i + L::width + __builtin_ctz(~m1) / L::mask_bits);
+			}
+			for (; i + L::width <= n; i += L::width) {
+				unsigned	m = L::eq(L::load(a + i), L::load(b + i));
+
+				if (m != full)
+					return (i + __builtin_ctz(~m) / L::mask_bits);
+			}
+			for (; i < n; ++i)
+				if (!(a[i] == b[i]))
+					return (i);
+			return (n);
+		}
+
+		/** @brief Sum of the elements
+		 * Integers wrap around like the scalar sum. Floating point elements are added in a different order than
+		 * the scalar loop (one partial sum per lane), so the result may differ in the last bits.
+		 */
+		template <class T>
+		T			sum(const T *p, size_t n) {
+			typedef lane<T>	L;
+			typename L::reg	acc0 = L::zero();
+			typename L::reg	acc1 = L::zero();
+			T				lanes[L::width];
+			T				result = T();
+			size_t			i = 0;
+
+			for (; i + 2 * L::width <= n; i += 2 * L::width) {
+				acc0 = L::add(acc0, L::load(p + i));
+				acc1 = L::add(acc1, L::load(p + i + L::width));
+			}
+			for (; i + L::width <= n; i += L::width)
+				acc0 = L::add(acc0, L::load(p + i));
+			L::store(lanes, L::add(acc0, acc1));
+			for (size_t j = 0; j < L::width; ++j)
+				result += lanes[j];
+			for (; i < n; ++i)
+				result += p[i];
+			return (result);
+		}
+
+		/** @brief Index of the first smallest element, n for an empty array
+		 * The smallest value is found a register at a time, then located with find.
+		 */
+		template <class T>
+		size_t		min_index(const T *p, size_t n) {
+			typedef lane<T>	L;
+			T				lanes[L::width];
+			size_t			i = L::width;
+
+			if (n < L::width) {
+				size_t	best = 0;
+
+				for (i = 1; i < n; ++i)
+					if (p[i] < p[best])
+						best = i;
+				return (n == 0 ? 0 : best);
+			}
+			typename L::reg	acc = L::load(p);
+
+			for (; i + L::width <= n; i += L::width)
+				acc = L::min(acc, L::load(p + i));
+			L::store(lanes, acc);
+			T		best = lanes[0];
+
+			for (size_t j = 1; j < L::width; ++j)
+				if (lanes[j] < best)
+					best = lanes[j];
+			for (; i < n; ++i)
+				if (p[i] < best)
+					best = p[i];
+			return (find(p, n, best));
+		}
+
+		/** @brief Index of the first largest element, n for an empty array
+		 */
+		template <class T>
+		size_t		max_index(const T *p, size_t n) {
+			typedef lane<T>	L;
+			T				lanes[L::width];
+			size_t			i = L::width;
+
+			if (n < L::width) {
+				size_t	best = 0;
+
+				for (i = 1; i < n; ++i)
+					if (p[best] < p[i])
+						best = i;
+				return (n == 0 ? 0 : best);
+			}
+			typename L::reg	acc = L::load(p);
+
+			for (; i + L::width <= n; i += L::width)
+				acc = L::max(acc, L::load(p + i));
+			L::store(lanes, acc);
+			T		best = lanes[0];
+
+			for (size_t j = 1; j < L::width; ++j)
+				if (best < lanes[j])
+					best = lanes[j];
+			for (; i < n; ++i)
+				if (best < p[i])
+					best = p[i];
+			return (find(p, n, best));
+		}
+# endif
+	}
+}
+
+#endif
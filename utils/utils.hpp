@@ -10,7 +10,12 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#ifndef UTILS_HPP
+#define UTILS_HPP
+
 # include <type_traits>
+# include <cstring>
+# include "simd.hpp"
 
 namespace ft {
 	/** @brief Enable type if condition is met
@@ -31,8 +36,190 @@ namespace ft {
 	};
 
 
+	/** @brief Is integral
+	 * Traits class that identifies whether T is an integral type.
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type, depending on whether T is an
+	 * integral type.
+	 *
+	 * All fundamental integral types, along with all their aliases (like those in cstdint), are considered integral
+	 * types by this class, including their const and volatile qualified variants.
+	 *
+	 * Enums are not considered integral types in C++
+	 *
+	 * @tparam T A type
+	 */
+	template <typename T> struct is_integral {static const bool value = false;};
+	template <> struct is_integral<bool> {static const bool value = true;};
+	template <> struct is_integral<char> {static const bool value = true;};
+	template <> struct is_integral<char16_t> {static const bool value = true;};
+	template <> struct is_integral<char32_t> {static const bool value = true;};
+	template <> struct is_integral<wchar_t> {static const bool value = true;};
+	template <> struct is_integral<signed char> {static const bool value = true;};
+	template <> struct is_integral<short int> {static const bool value = true;};
+	template <> struct is_integral<int> {static const bool value = true;};
+	template <> struct is_integral<long int> {static const bool value = true;};
+	template <> struct is_integral<long long int> {static const bool value = true;};
+	template <> struct is_integral<unsigned char> {static const bool value = true;};
+	template <> struct is_integral<unsigned short int> {static const bool value = true;};
+	template <> struct is_integral<unsigned int> {static const bool value = true;};
+	template <> struct is_integral<unsigned long int> {static const bool value = true;};
+	template <> struct is_integral<unsigned long long int> {static const bool value = true;};
+
+	/** @brief Integral constant
+	 * This template is designed to provide compile-time constants as types.
+	 *
+	 * It is used as the base class for the triviality traits below, and it's two instantiations true_type and
+	 * false_type are used as tags to select between overloads at compile time.
+	 *
+	 * @tparam T Type of the integral constant
+	 * @tparam v Value of the integral constant
+	 */
+	template <class T, T v> struct integral_constant {
+		typedef T					value_type;
+		typedef integral_constant	type;
+		static const T value = v;
+	};
+	typedef integral_constant<bool, true>	true_type;
+	typedef integral_constant<bool, false>	false_type;
+
+	/** @brief Is trivially copyable
+	 * Traits class that identifies whether T is a trivially copyable type, i.e. a type whose objects can be copied
+	 * (and relocated) with a plain memcpy/memmove of their bytes.
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type.
+	 *
+	 * @tparam T A type
+	 */
+	template <typename T> struct is_trivially_copyable : integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+
+	/** @brief Is trivially destructible
+	 * Traits class that identifies whether T is a type whose destructor does nothing, so destroying a range of T
+	 * can be skipped altogether.
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type.
+	 *
+	 * @tparam T A type
+	 */
+	template <typename T> struct is_trivially_destructible : integral_constant<bool, std::is_trivially_destructible<T>::value> {};
+
+	/** @brief Is trivially default constructible
+	 * Traits class that identifies whether T is a type whose default initialization does nothing, so its storage
+	 * may be handed out without being written to.
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type.
+	 *
+	 * @tparam T A type
+	 */
+	template <typename T> struct is_trivially_default_constructible : integral_constant<bool, std::is_trivially_default_constructible<T>::value> {};
+
+	/** @brief Has reallocate
+	 * Traits class that identifies whether the allocator Alloc provides a member function
+	 * reallocate(pointer p, size_type old_n, size_type new_n) able to grow a block in place (see ft::MmapAllocator).
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type.
+	 *
+	 * @tparam Alloc An allocator type
+	 */
+	template <typename Alloc> struct has_reallocate {
+		private:
+			template <typename A> static char	_test(decltype(&A::reallocate));
+			template <typename A> static long	_test(...);
+		public:
+			static const bool value = (sizeof(_test<Alloc>(0)) == sizeof(char));
+	};
+
+	/** @brief Has release
+	 * Traits class that identifies whether the allocator Alloc provides a member function release() giving back
+	 * everything it allocated at once (see ft::PoolAllocator).
+	 *
+	 * @tparam Alloc An allocator type
+	 */
+	template <typename Alloc> struct has_release {
+		private:
+			template <typename A> static char	_test(decltype(&A::release));
+			template <typename A> static long	_test(...);
+		public:
+			static const bool value = (sizeof(_test<Alloc>(0)) == sizeof(char));
+	};
+
+	/** @brief Is transparent
+	 * Traits class that identifies whether the comparator Compare declares a member type is_transparent, telling it
+	 * compares keys with values of other types (as std::less<> does), so lookups need not convert those to keys.
+	 *
+	 * @tparam Compare A comparator type
+	 */
+	template <typename Compare> struct is_transparent {
+		private:
+			template <typename C> static char	_test(typename C::is_transparent*);
+			template <typename C> static long	_test(...);
+		public:
+			static const bool value = (sizeof(_test<Compare>(0)) == sizeof(char));
+	};
+
+	template <typename T> class random_access_iterator;
+
+	/** @brief Contiguous iterator
+	 * Traits class that identifies iterators over elements stored next to each other in memory: pointers and the
+	 * ft::random_access_iterator of Vector. For those, element_type is the element type without cv-qualifiers,
+	 * address() returns the pointer to the element an iterator points to, and an iterator is built back from a
+	 * pointer with it's converting constructor. Algorithms use it to run over the raw memory of a range.
+	 *
+	 * It inherits from integral_constant as being either true_type or false_type.
+	 *
+	 * @tparam Iterator An iterator type
+	 */
+	template <typename Iterator> struct contiguous_iterator : false_type {
+		typedef void	element_type;
+	};
+	template <typename T> struct contiguous_iterator<T*> : true_type {
+		typedef typename std::remove_cv<T>::type	element_type;
+
+		static T	*address(T *it) {
+			return (it);
+		}
+	};
+	template <typename T> struct contiguous_iterator<ft::random_access_iterator<T> > : true_type {
+		typedef typename std::remove_cv<T>::type	element_type;
+
+		static T	*address(const ft::random_access_iterator<T>& it) {
+			return (it.operator->());
+		}
+	};
+
+	/*
+	 * Two contiguous ranges of the same integral type: their elements are equal exactly when their bytes are, and
+	 * their first difference can be looked for a register at a time.
+	 */
+	template <class It1, class It2>
+	struct _contiguous_integral : integral_constant<bool, contiguous_iterator<It1>::value && contiguous_iterator<It2>::value
+			&& std::is_same<typename contiguous_iterator<It1>::element_type, typename contiguous_iterator<It2>::element_type>::value
+			&& std::is_integral<typename contiguous_iterator<It1>::element_type>::value> {};
+
+	/*
+	 * Integral types ordered like memcmp orders their bytes: the unsigned single byte ones
+	 */
+	template <class T>
+	struct _memcmp_ordered : integral_constant<bool, std::is_same<T, unsigned char>::value
+			|| (std::is_same<T, char>::value && static_cast<char>(-1) > 0)> {};
+
+	template <class T>
+	size_t	_mismatch(const T *p1, const T *p2, size_t n, false_type) {
+		size_t	i = 0;
+
+		while (i < n && p1[i] == p2[i])
+			i++;
+		return (i);
+	}
+# if defined(FT_SIMD_AVX2) || defined(FT_SIMD_SSE2)
+	template <class T>
+	size_t	_mismatch(const T *p1, const T *p2, size_t n, true_type) {
+		return (simd::mismatch(p1, p2, n));
+	}
+# endif
+
 	template<class lhit, class rhit>
-	bool equal(lhit first1, lhit last1, rhit first2)
+	bool	_equal(lhit first1, lhit last1, rhit first2, false_type)
 	{
 		while (first1 != last1) {
 		  if (!(*first1 == *first2))
@@ -41,6 +228,26 @@ namespace ft {
 		}
 		return true;
 	}
+	template<class lhit, class rhit>
+	bool	_equal(lhit first1, lhit last1, rhit first2, true_type)
+	{
+		typedef typename contiguous_iterator<lhit>::element_type	element_type;
+		const element_type	*p1 = contiguous_iterator<lhit>::address(first1);
+		size_t				n = contiguous_iterator<lhit>::address(last1) - p1;
+
+		return (n == 0 || std::memcmp(p1, contiguous_iterator<rhit>::address(first2), n * sizeof(element_type)) == 0);
+	}
+
+	/** @brief Test whether the elements in two ranges are equal
+	 * Compares the elements in the range [first1, last1) with those in the range beginning at first2, and returns
+	 * true if all of the elements in both ranges match. Contiguous ranges of the same integral type (ft::Vector
+	 * of integers, pointers ...) are compared with a single memcmp.
+	 */
+	template<class lhit, class rhit>
+	bool equal(lhit first1, lhit last1, rhit first2)
+	{
+		return (_equal(first1, last1, first2, _contiguous_integral<lhit, rhit>()));
+	}
 	template <class lhit, class rhit, class BinaryPredicate>
 	bool equal ( lhit first1, lhit last1, rhit first2, BinaryPredicate pred)
 	{
@@ -53,8 +260,8 @@ namespace ft {
 	}
 
 	template <class InputIterator1, class InputIterator2>
-  	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
-                                InputIterator2 first2, InputIterator2 last2){
+	bool	_lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, false_type) {
 		while (first1!=last1)
 		{
 		  if (first2==last2 || *first2<*first1)
@@ -65,6 +272,36 @@ namespace ft {
 		}
 		return (first2!=last2);
 	}
+	template <class InputIterator1, class InputIterator2>
+	bool	_lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, true_type) {
+		typedef typename contiguous_iterator<InputIterator1>::element_type	element_type;
+		const element_type	*p1 = contiguous_iterator<InputIterator1>::address(first1);
+		const element_type	*p2 = contiguous_iterator<InputIterator2>::address(first2);
+		size_t				n1 = contiguous_iterator<InputIterator1>::address(last1) - p1;
+		size_t				n2 = contiguous_iterator<InputIterator2>::address(last2) - p2;
+		size_t				n = (n1 < n2) ? n1 : n2;
+
+		if (_memcmp_ordered<element_type>::value) {
+			int	order = (n == 0) ? 0 : std::memcmp(p1, p2, n);
+
+			return (order != 0 ? order < 0 : n1 < n2);
+		}
+		size_t	i = _mismatch(p1, p2, n, integral_constant<bool, simd::lane<element_type>::vectorized>());
+
+		return (i != n ? p1[i] < p2[i] : n1 < n2);
+	}
+
+	/** @brief Lexicographical less-than comparison
+	 * Returns true if the range [first1, last1) compares lexicographically less than the range [first2, last2).
+	 * For contiguous ranges of the same integral type, the first mismatch is found with memcmp (unsigned bytes) or
+	 * the vector kernels of simd.hpp, then only that pair of elements is compared.
+	 */
+	template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+								InputIterator2 first2, InputIterator2 last2) {
+		return (_lexicographical_compare(first1, last1, first2, last2, _contiguous_integral<InputIterator1, InputIterator2>()));
+	}
 	template <class InputIterator1, class InputIterator2, class Compare>
 		  bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
 										InputIterator2 first2, InputIterator2 last2,
@@ -75,35 +312,6 @@ namespace ft {
 				}
 				return (first1 == last1) && (first2 != last2);
 			}
-	/** @brief Is integral
-	 * Traits class that identifies whether T is an integral type.
-	 *
-	 * It inherits from integral_constant as being either true_type or false_type, depending on whether T is an
-	 * integral type.
-	 *
-	 * All fundamental integral types, along with all their aliases (like those in cstdint), are considered integral
-	 * types by this class, including their const and volatile qualified variants.
-	 *
-	 * Enums are not considered integral types in C++
-	 *
-	 * @tparam T A type
-	 */
-	template <typename T> struct is_integral {static const bool value = false;};
-	template <> struct is_integral<bool> {static const bool value = true;};
-	template <> struct is_integral<char> {static const bool value = true;};
-	template <> struct is_integral<char16_t> {static const bool value = true;};
-	template <> struct is_integral<char32_t> {static const bool value = true;};
-	template <> struct is_integral<wchar_t> {static const bool value = true;};
-	template <> struct is_integral<signed char> {static const bool value = true;};
-	template <> struct is_integral<short int> {static const bool value = true;};
-	template <> struct is_integral<int> {static const bool value = true;};
-	template <> struct is_integral<long int> {static const bool value = true;};
-	template <> struct is_integral<long long int> {static const bool value = true;};
-	template <> struct is_integral<unsigned char> {static const bool value = true;};
-	template <> struct is_integral<unsigned short int> {static const bool value = true;};
-	template <> struct is_integral<unsigned int> {static const bool value = true;};
-	template <> struct is_integral<unsigned long int> {static const bool value = true;};
-	template <> struct is_integral<unsigned long long int> {static const bool value = true;};
 
 	/** @brief Binary function object base class
 	 * This is a base class for standard binary function objects.
@@ -141,6 +349,13 @@ namespace ft {
 	template <class T> struct less : binary_function <T,T,bool> {
 		bool operator() (const T& x, const T& y) const {return x<y;}
 	};
+
+	/** @brief Sorted unique range tag
+	 * Selects the constructors of Map and Set that take a range already sorted by the container's comparison,
+	 * without duplicate keys, and build their tree from it in linear time.
+	 */
+	struct sorted_unique_t {};
+	static const sorted_unique_t	sorted_unique = sorted_unique_t();
 //    template< typename T>
 //    void	swap( T &x, T &y) {
 //        T	tmp;
@@ -149,4 +364,6 @@ namespace ft {
 //        x = y;
 //        y = tmp;
 //    }
-}
\ No newline at end of file
+}
+
+#endif